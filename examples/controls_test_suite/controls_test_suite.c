@@ -232,6 +232,9 @@ int main()
             }
             
             GuiUnlock();
+
+            // Resolve topmost control for next frame, controls below message boxes do not react
+            GuiUpdateHitTest();
             //----------------------------------------------------------------------------------
 
         EndDrawing();
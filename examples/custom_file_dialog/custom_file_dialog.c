@@ -41,6 +41,7 @@ int main()
 
     // Custom file dialog
     GuiFileDialogState fileDialogState = InitGuiFileDialog();
+    fileDialogState.thumbnailsActive = true;    // Show image files thumbnails
 
     bool exitWindow = false;
 
@@ -106,6 +107,8 @@ int main()
     //--------------------------------------------------------------------------------------
     UnloadTexture(texture);     // Unload texture
 
+    UnloadGuiFileDialog(&fileDialogState);  // Unload file dialog data (thumbnails cache)
+
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
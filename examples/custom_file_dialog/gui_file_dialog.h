@@ -1,6 +1,6 @@
 /*******************************************************************************************
 *
-*   FileDialog v1.0.0 - Modal file dialog to open/save files
+*   FileDialog v1.1.0 - Modal file dialog to open/save files
 *
 *   MODULE USAGE:
 *       #define GUI_FILE_DIALOG_IMPLEMENTATION
@@ -9,13 +9,54 @@
 *       INIT: GuiFileDialogState state = InitGuiFileDialog();
 *       DRAW: GuiFileDialog(&state);
 *
+*   Directory is read on a worker thread, entries are added to the files list as they
+*   are read (no limit on entries count), reading is cancelled when dialog moves to another
+*   directory or it is closed. Dialog never waits for the worker thread.
+*
+*   Entries are kept sorted (directories first, then by name, size or date) as they are read.
+*   Typing filters visible entries by search text: entries starting with it are listed first,
+*   then entries containing its characters in order (fuzzy). Sort and search never re-read
+*   the directory, each keystroke only filters entries still visible with previous text.
+*
+*   Image thumbnails are shown if state.thumbnailsActive is set: images are decoded and downscaled
+*   on worker threads (if a thread-safe decoder is available), only for visible rows, and kept in a
+*   least recently used cache (keyed by file path and modification time) within a memory budget.
+*   Thumbnails are uploaded to GPU when visible. Thumbnails cache is kept while dialog is closed,
+*   unload it with UnloadGuiFileDialog().
+*
+*   CONFIGURATION:
+*
+*   #define GUI_FILE_DIALOG_THUMBNAIL_SIZE
+*       Thumbnails maximum width and height in pixels
+*
+*   #define GUI_FILE_DIALOG_THUMBNAIL_THREADS
+*       Worker threads decoding thumbnails
+*
+*   #define GUI_FILE_DIALOG_THUMBNAIL_BUDGET
+*       Thumbnails cache memory budget in bytes (visible thumbnails are always kept)
+*
+*   #define GUI_FILE_DIALOG_LOAD_PIXELS(data, size, width, height, channels)
+*   #define GUI_FILE_DIALOG_UNLOAD_PIXELS(pixels)
+*       Image decoding from file data to R8G8B8A8 pixels, it must be thread-safe (raylib LoadImage()
+*       is not). Thumbnails are decoded on worker threads only if a decoder is available, otherwise
+*       they are loaded with raylib LoadImage() on main thread (one per frame). Pixels are freed
+*       with RL_FREE() if GUI_FILE_DIALOG_UNLOAD_PIXELS is not defined.
+*
+*   #define GUI_FILE_DIALOG_STB_IMAGE
+*       Use stb_image as thumbnails decoder: stbi_load_from_memory() and stbi_image_free() must be
+*       linked, exported by raylib (static library or shared library with default symbols visibility)
+*       or by a STB_IMAGE_IMPLEMENTATION compiled in the program (not static, STB_IMAGE_STATIC)
+*
 *   NOTE: This module depends on some raylib file system functions:
-*       - GetDirectoryFiles()
-*       - ClearDirectoryFiles()
+*       - GetDirectoryFiles(), ClearDirectoryFiles() (only on Windows, see below)
 *       - GetWorkingDirectory()
+*       - GetPrevDirectoryPath()
 *       - DirectoryExists()
 *       - FileExists()
 *
+*   NOTE: Worker threads require POSIX threads and dirent, on Windows directory is read
+*   synchronously with raylib GetDirectoryFiles() and thumbnails are not available
+*
 *   LICENSE: Propietary License
 *
 *   Copyright (c) 2019 raylib technologies (@raylibtech). All Rights Reserved.
@@ -35,18 +76,27 @@
 #ifndef GUI_FILE_DIALOG_H
 #define GUI_FILE_DIALOG_H
 
+// Directory entry
+typedef struct {
+    char *text;                 // Entry text as shown in files list: "#icon#name"
+    char *name;                 // Entry file name (points into text)
+    bool isDirectory;           // Entry is a directory
+    long long size;             // File size in bytes (0 for directories)
+    long long modTime;          // Last modification time (seconds since epoch)
+} GuiFileDialogEntry;
+
 typedef struct {
     Vector2 position;
-    
+
     bool fileDialogActive;
-    
+
     bool dirPathEditMode;
     char dirPathText[256];
-    
+
     int filesListScrollIndex;
     bool filesListEditMode;
     int filesListActive;
-    
+
     bool fileNameEditMode;
     char fileNameText[256];
     bool SelectFilePressed;
@@ -55,14 +105,31 @@ typedef struct {
 
     // Custom state variables (depend on development software)
     // NOTE: This variables should be added manually if required
-    char **dirFiles;
+    GuiFileDialogEntry *dirFiles;       // Directory entries, added while directory is read
+    int *dirFilesSorted;                // Entries sorted: directories first, then by sort mode
+    int *dirFilesVisible;               // Sorted entries matching search text, as shown in list view
+    const char **dirFilesText;          // Visible entries text, as required by list view
     int dirFilesCount;
+    int dirFilesSortedCount;            // Entries already included in sorted list
+    int dirFilesVisibleCount;
+    int dirFilesPrefixCount;            // Visible entries starting with search text (listed first)
+    int dirFilesCapacity;
+    void *dirScan;                      // Directory reading in progress (NULL if none)
+
+    bool searchEditMode;
+    char searchText[64];
+    char searchTextCopy[64];            // Search text visible entries were filtered with
+    int sortModeActive;                 // Sort mode: 0-Name, 1-Size, 2-Date
+    int prevSortModeActive;
+
+    bool thumbnailsActive;              // Show image files thumbnails
+    void *thumbnails;                   // Thumbnails cache (NULL until required)
 
     char filterExt[256];
-    
+
     char dirPathTextCopy[256];
     char fileNameTextCopy[256];
-    
+
     int prevFilesListActive;
 
 } GuiFileDialogState;
@@ -91,6 +158,7 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 GuiFileDialogState InitGuiFileDialog(void);
 void GuiFileDialog(GuiFileDialogState *state);
+void UnloadGuiFileDialog(GuiFileDialogState *state);        // Unload dialog data (directory entries, thumbnails cache)
 
 #ifdef __cplusplus
 }
@@ -107,13 +175,67 @@ void GuiFileDialog(GuiFileDialogState *state);
 
 #include "../../src/raygui.h"
 
-#include <string.h>     // Required for: strcpy()
+#include <stdio.h>      // Required for: snprintf()
+#include <stdlib.h>     // Required for: malloc(), realloc(), free() [Used in RL_MALLOC(), RL_REALLOC(), RL_FREE()]
+#include <string.h>     // Required for: strcpy(), strcmp(), strrchr(), strlen(), memcpy()
+#include <ctype.h>      // Required for: tolower()
+#include <sys/stat.h>   // Required for: stat()
+
+#if !defined(_WIN32)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_detach(), pthread_mutex_*()
+    #include <dirent.h>         // Required for: opendir(), readdir(), closedir()
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define MAX_DIRECTORY_FILES    1024
 #define MAX_DIR_PATH_LENGTH    1024
+#define DIR_FILES_BATCH          64     // Entries read by worker thread before adding them to pending list
+
+#if !defined(GUI_FILE_DIALOG_THUMBNAIL_SIZE)
+    #define GUI_FILE_DIALOG_THUMBNAIL_SIZE          64      // Thumbnails maximum width and height
+#endif
+#if !defined(GUI_FILE_DIALOG_THUMBNAIL_THREADS)
+    #define GUI_FILE_DIALOG_THUMBNAIL_THREADS        4      // Worker threads decoding thumbnails
+#endif
+#if !defined(GUI_FILE_DIALOG_THUMBNAIL_BUDGET)
+    #define GUI_FILE_DIALOG_THUMBNAIL_BUDGET  (16*1024*1024)    // Thumbnails cache memory budget (bytes)
+#endif
+
+#if defined(GUI_FILE_DIALOG_STB_IMAGE) && !defined(GUI_FILE_DIALOG_LOAD_PIXELS)
+    // NOTE: stb_image implementation must be linked (i.e. exported by raylib textures module)
+    #if defined(__cplusplus)
+    extern "C" {
+    #endif
+    unsigned char *stbi_load_from_memory(const unsigned char *buffer, int len, int *x, int *y, int *comp, int req_comp);
+    void stbi_image_free(void *retval_from_stbi_load);
+    #if defined(__cplusplus)
+    }
+    #endif
+
+    #define GUI_FILE_DIALOG_LOAD_PIXELS(data, size, width, height, channels)    stbi_load_from_memory(data, size, width, height, channels, 4)
+    #if !defined(GUI_FILE_DIALOG_UNLOAD_PIXELS)
+        #define GUI_FILE_DIALOG_UNLOAD_PIXELS(pixels)    stbi_image_free(pixels)
+    #endif
+#endif
+#if defined(GUI_FILE_DIALOG_LOAD_PIXELS) && !defined(GUI_FILE_DIALOG_UNLOAD_PIXELS)
+    #define GUI_FILE_DIALOG_UNLOAD_PIXELS(pixels)    RL_FREE(pixels)
+#endif
+
+#define THUMBNAIL_EXTENSIONS    ".png;.bmp;.tga;.gif;.jpg;.jpeg;.psd;.hdr"   // Image files with thumbnail
+#define THUMBNAIL_HASH_SIZE     1024    // Thumbnails cache hash table buckets (power of 2)
+
+// Thumbnail states
+#define THUMBNAIL_NEW              0    // Requested, not queued yet
+#define THUMBNAIL_QUEUED           1    // Queued or being decoded by a worker thread
+#define THUMBNAIL_LOADED           2    // Decoded, uploaded to GPU when visible
+#define THUMBNAIL_READY            3    // Uploaded to GPU
+#define THUMBNAIL_FAILED           4    // Could not be decoded (not retried while cached)
+
+// Entries sort modes
+#define DIR_FILES_SORT_NAME       0
+#define DIR_FILES_SORT_SIZE       1     // Bigger first
+#define DIR_FILES_SORT_DATE       2     // Newer first
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -130,20 +252,108 @@ typedef struct FileInfo {
 } FileInfo;
 #endif
 
-//----------------------------------------------------------------------------------
-// Global Variables Definition
-//----------------------------------------------------------------------------------
-char **dirFilesIcon = NULL;
+// Directory reading, shared between dialog and worker thread
+// NOTE: Once cancelled, worker thread owns it and frees it when it stops
+typedef struct DirectoryScan {
+    char dirPath[MAX_DIR_PATH_LENGTH];  // Directory to read
+    char filterExt[256];                // Extensions filter (copy)
+
+    GuiFileDialogEntry *entries;        // Entries read, pending to be added to dialog
+    int entriesCount;
+    int entriesCapacity;
+
+    bool finished;                      // Worker thread has stopped
+    bool cancelled;                     // Dialog does not want more entries
+#if !defined(_WIN32)
+    pthread_t thread;
+    pthread_mutex_t mutex;              // Protects entries, finished and cancelled
+#endif
+} DirectoryScan;
+
+#if !defined(_WIN32)
+// Image file thumbnail
+typedef struct Thumbnail {
+    char *fileName;                     // Image file path
+    long long modTime;                  // Image file modification time (part of cache key)
+    unsigned int hash;                  // File path and modification time hash
+    int state;                          // Thumbnail state: THUMBNAIL_NEW, THUMBNAIL_QUEUED...
+    Image image;                        // Decoded thumbnail (set by worker thread)
+    Texture2D texture;                  // Uploaded thumbnail
+    int dataSize;                       // Bytes accounted in cache budget
+    unsigned int frame;                 // Last frame thumbnail was visible
+    struct Thumbnail *next;             // Next thumbnail in hash bucket
+    struct Thumbnail *lruPrev;          // Least recently used list (only loaded, ready and failed thumbnails)
+    struct Thumbnail *lruNext;
+} Thumbnail;
+
+// Thumbnails cache, shared between dialog and worker threads
+// NOTE: Worker threads only access jobs and done lists (and thumbnails between them)
+typedef struct ThumbnailCache {
+    Thumbnail *buckets[THUMBNAIL_HASH_SIZE];    // Cached thumbnails hash table
+    Thumbnail *lruFirst;                // Most recently used thumbnail
+    Thumbnail *lruLast;                 // Least recently used thumbnail, first removed over budget
+    int dataSize;                       // Cached thumbnails bytes
+    unsigned int frame;                 // Frame counter
+
+    Thumbnail **pending;                // Thumbnails requested, to be queued
+    int pendingCount;
+    int pendingCapacity;
+
+    Thumbnail **jobs;                   // Thumbnails queued to worker threads
+    int jobsCount;
+    int jobsCapacity;
+    Thumbnail **done;                   // Thumbnails decoded by worker threads
+    int doneCount;
+    int doneCapacity;
+    bool quit;                          // Worker threads must stop
+
+    pthread_t threads[GUI_FILE_DIALOG_THUMBNAIL_THREADS];
+    int threadsCount;
+    pthread_mutex_t mutex;              // Protects jobs, done and quit
+    pthread_cond_t cond;                // Signals jobs queued or quit
+} ThumbnailCache;
+#endif
 
 //----------------------------------------------------------------------------------
 // Internal Module Functions Definition
 //----------------------------------------------------------------------------------
-// Read all filenames from directory (supported file types)
-static char **ReadDirectoryFiles(const char *dir, int *filesCount, char *filterExt);
+static void StartDirectoryScan(GuiFileDialogState *state);      // Start reading state->dirPathText, previous entries are unloaded
+static void UpdateDirectoryScan(GuiFileDialogState *state);     // Add entries read by worker thread to dialog (never waits)
+static void CancelDirectoryScan(GuiFileDialogState *state);     // Cancel directory reading (never waits)
+static void UnloadDirectoryFiles(GuiFileDialogState *state);    // Unload directory entries
+
+static bool AddDirectoryFiles(GuiFileDialogState *state, const GuiFileDialogEntry *entries, int count);
+static void UpdateDirectoryFiles(GuiFileDialogState *state);    // Update sorted and visible entries (new entries, sort mode, search text)
+static void FilterDirectoryFiles(GuiFileDialogState *state, bool narrow);   // Filter visible entries by search text
+static int CompareFileEntries(const GuiFileDialogEntry *entry1, const GuiFileDialogEntry *entry2, int mode);
+static void SortFileEntries(int *indices, int count, const GuiFileDialogEntry *entries, int mode);  // Sort entries indices (in place, reentrant)
+static void SiftFileEntriesHeap(int *indices, int root, int count, const GuiFileDialogEntry *entries, int mode);   // Restore entries indices heap from root
+static bool MatchTextPrefix(const char *text, const char *search);  // Check text starts with search (case insensitive)
+static bool MatchTextFuzzy(const char *text, const char *search);   // Check text contains search characters in order (case insensitive)
+
+static GuiFileDialogEntry LoadFileEntry(const char *name, bool isDirectory, const struct stat *info);  // Load directory entry (thread-safe)
+static bool CheckFileExtension(const char *fileName, const char *filterExt);    // Check file extension in filter (thread-safe)
+
+#if !defined(_WIN32)
+static void *DirectoryScanThread(void *arg);                                    // Directory reading worker thread
+static bool PushDirectoryScanEntries(DirectoryScan *scan, GuiFileDialogEntry *batch, int count);
+static void UnloadDirectoryScan(DirectoryScan *scan);
+
+static void DrawThumbnails(GuiFileDialogState *state, Rectangle bounds);   // Draw thumbnails for visible image entries
+static Thumbnail *RequestThumbnail(ThumbnailCache *cache, const char *fileName, long long modTime);
+static void RemoveThumbnail(ThumbnailCache *cache, Thumbnail *thumb);
+static void UpdateThumbnailCache(ThumbnailCache *cache);       // Queue requested thumbnails, collect decoded ones (never waits)
+static void UnloadThumbnailCache(ThumbnailCache *cache);
+#if defined(GUI_FILE_DIALOG_LOAD_PIXELS)
+static void *ThumbnailThread(void *arg);                        // Thumbnails decoding worker thread
+#endif
+static void CacheThumbnail(ThumbnailCache *cache, Thumbnail *thumb);    // Add decoded thumbnail to cache
+static Image LoadThumbnailImage(const char *fileName);          // Load thumbnail from image file (thread-safe if decoder available)
+#endif
 
 #if defined(USE_CUSTOM_LISTVIEW_FILEINFO)
 // List View control for files info with extended parameters
-static int GuiListViewFiles(Rectangle bounds, FileInfo *files, int count, int *focus, int *scrollIndex, int active)
+static int GuiListViewFiles(Rectangle bounds, FileInfo *files, int count, int *focus, int *scrollIndex, int active);
 #endif
 
 //----------------------------------------------------------------------------------
@@ -154,14 +364,14 @@ GuiFileDialogState InitGuiFileDialog(void)
     GuiFileDialogState state = { 0 };
 
     state.position = (Vector2){ GetScreenWidth()/2 - 480/2, GetScreenHeight()/2 - 305/2 };
-    
+
     state.fileDialogActive = false;
     state.dirPathEditMode = false;
-    
+
     state.filesListActive = -1;
     state.prevFilesListActive = state.filesListActive;
     state.filesListScrollIndex = 0;
-    
+
     state.fileNameEditMode = false;
 
     state.SelectFilePressed = false;
@@ -172,12 +382,27 @@ GuiFileDialogState InitGuiFileDialog(void)
     // Custom variables initialization
     strcpy(state.dirPathText, GetWorkingDirectory());
     strcpy(state.dirPathTextCopy, state.dirPathText);
-    
+
     strcpy(state.filterExt, "all");
 
     state.dirFilesCount = 0;
+    state.dirFilesCapacity = 0;
     state.dirFiles = NULL;      // NOTE: Loaded lazily on window active
-    
+    state.dirFilesSorted = NULL;
+    state.dirFilesVisible = NULL;
+    state.dirFilesText = NULL;
+    state.dirScan = NULL;
+
+    state.searchEditMode = false;
+    strcpy(state.searchText, "\0");
+    strcpy(state.searchTextCopy, state.searchText);
+
+    state.sortModeActive = DIR_FILES_SORT_NAME;
+    state.prevSortModeActive = state.sortModeActive;
+
+    state.thumbnailsActive = false;
+    state.thumbnails = NULL;
+
     strcpy(state.fileNameText, "\0");
     strcpy(state.fileNameTextCopy, state.fileNameText);
 
@@ -185,94 +410,107 @@ GuiFileDialogState InitGuiFileDialog(void)
 }
 
 void GuiFileDialog(GuiFileDialogState *state)
-{   
+{
     if (state->fileDialogActive)
     {
-        // Load dirFilesIcon and state->dirFiles lazily on windows open
-        // NOTE: they are automatically unloaded at fileDialog closing
+        // Start reading directory lazily on window open and add entries read since last frame
+        // NOTE: Entries are automatically unloaded at fileDialog closing
         //------------------------------------------------------------------------------------
-        if (dirFilesIcon == NULL)
-        {
-            dirFilesIcon = (char **)RL_MALLOC(MAX_DIRECTORY_FILES*sizeof(char *));    // Max files to read
-            for (int i = 0; i < MAX_DIRECTORY_FILES; i++) dirFilesIcon[i] = (char *)calloc(MAX_DIR_PATH_LENGTH, 1);    // Max file name length
-        }
-    
-        if (state->dirFiles == NULL) state->dirFiles = ReadDirectoryFiles(state->dirPathText, &state->dirFilesCount, state->filterExt);
+        if (state->dirFiles == NULL) StartDirectoryScan(state);
+
+        UpdateDirectoryScan(state);
         //------------------------------------------------------------------------------------
 
         DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.85f));
         state->fileDialogActive = !GuiWindowBox((Rectangle){ state->position.x + 0, state->position.y + 0, 480, 310 }, "#198#Select File Dialog");
-        
+
         if (GuiButton((Rectangle){ state->position.x + 430, state->position.y + 35, 40, 25 }, "< .."))
         {
             // Move dir path one level up
             strcpy(state->dirPathText, GetPrevDirectoryPath(state->dirPathText));
-            
-            // RL_FREE previous dirFiles (reloaded by ReadDirectoryFiles())
-            for (int i = 0; i < state->dirFilesCount; i++) RL_FREE(state->dirFiles[i]);
-            RL_FREE(state->dirFiles);
-            
-            // Read files in the new path
-            state->dirFiles = ReadDirectoryFiles(state->dirPathText, &state->dirFilesCount, state->filterExt);
-            
+            strcpy(state->dirPathTextCopy, state->dirPathText);
+
+            // Read files in the new path (previous reading cancelled)
+            StartDirectoryScan(state);
+
             state->filesListActive = -1;
             strcpy(state->fileNameText, "\0");
             strcpy(state->fileNameTextCopy, state->fileNameText);
         }
-        
-        if (GuiTextBox((Rectangle){ state->position.x + 10, state->position.y + 35, 410, 25 }, state->dirPathText, 256, state->dirPathEditMode)) 
+
+        if (GuiTextBox((Rectangle){ state->position.x + 10, state->position.y + 35, 410, 25 }, state->dirPathText, 256, state->dirPathEditMode))
         {
             if (state->dirPathEditMode)
             {
                 // Verify if a valid path has been introduced
                 if (DirectoryExists(state->dirPathText))
                 {
-                    // RL_FREE previous dirFiles (reloaded by ReadDirectoryFiles())
-                    for (int i = 0; i < state->dirFilesCount; i++) RL_FREE(state->dirFiles[i]);
-                    RL_FREE(state->dirFiles);
-                    
-                    // Read files in new path
-                    state->dirFiles = ReadDirectoryFiles(state->dirPathText, &state->dirFilesCount, state->filterExt);
-                    
+                    // Read files in new path (previous reading cancelled)
+                    StartDirectoryScan(state);
+
+                    state->filesListActive = -1;
                     strcpy(state->dirPathTextCopy, state->dirPathText);
                 }
                 else strcpy(state->dirPathText, state->dirPathTextCopy);
             }
-            
+
             state->dirPathEditMode = !state->dirPathEditMode;
         }
-        
-        int prevTextAlignment = GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT);
-        int prevElementsHeight = GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT);
+
+        // Type-to-filter: text typed while no other text box is being edited starts search
+        if (!state->searchEditMode && !state->dirPathEditMode && !state->fileNameEditMode)
+        {
+            int key = GetKeyPressed();
+
+            if ((key >= 32) && (key <= 125))
+            {
+                int length = (int)strlen(state->searchText);
+
+                if (length < (int)sizeof(state->searchText) - 1)
+                {
+                    state->searchText[length] = (char)key;
+                    state->searchText[length + 1] = '\0';
+                }
+
+                state->searchEditMode = true;
+            }
+        }
+
+        if (GuiTextBox((Rectangle){ state->position.x + 10, state->position.y + 70, 300, 25 }, state->searchText, 64, state->searchEditMode)) state->searchEditMode = !state->searchEditMode;
+
+        state->sortModeActive = GuiComboBox((Rectangle){ state->position.x + 320, state->position.y + 70, 150, 25 }, "Sort by name;Sort by size;Sort by date", state->sortModeActive);
+
+        // Update visible entries: new entries read, sort mode or search text changed
+        UpdateDirectoryFiles(state);
+
+        Rectangle filesListBounds = { state->position.x + 10, state->position.y + 100, 460, 134 };
+
+        GuiPushStyle();
         GuiSetStyle(LISTVIEW, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_LEFT);
-        GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, 24);
-        
-        // TODO: ListViewElements should be aligned left
-        state->filesListActive = GuiListViewEx((Rectangle){ state->position.x + 10, state->position.y + 70, 460, 164 }, (const char **)dirFilesIcon, state->dirFilesCount, NULL, &state->filesListScrollIndex, state->filesListActive);
-        
-        GuiSetStyle(LISTVIEW, TEXT_ALIGNMENT, prevTextAlignment);
-        GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, prevElementsHeight);
-        
+        GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, state->thumbnailsActive? 40 : 24);
+
+        state->filesListActive = GuiListViewEx(filesListBounds, state->dirFilesText, state->dirFilesVisibleCount, NULL, &state->filesListScrollIndex, state->filesListActive, false);
+#if !defined(_WIN32)
+        if (state->thumbnailsActive) DrawThumbnails(state, filesListBounds);
+#endif
+        GuiPopStyle();
+
         if ((state->filesListActive >= 0) && (state->filesListActive != state->prevFilesListActive))
         {
-            strcpy(state->fileNameText, state->dirFiles[state->filesListActive]);
+            const GuiFileDialogEntry *entry = &state->dirFiles[state->dirFilesVisible[state->filesListActive]];
+
+            strcpy(state->fileNameText, entry->name);
 
-            if (DirectoryExists(TextFormat("%s\\%s", state->dirPathText, state->fileNameText)))
+            if (entry->isDirectory)
             {
                 if (TextIsEqual(state->fileNameText, "..")) strcpy(state->dirPathText, GetPrevDirectoryPath(state->dirPathText));
-                else strcpy(state->dirPathText, TextFormat("%s\\%s", state->dirPathText, state->fileNameText));
-                
-                strcpy(state->dirPathTextCopy, state->dirPathText);
-                
-                // RL_FREE previous dirFiles (reloaded by ReadDirectoryFiles())
-                for (int i = 0; i < state->dirFilesCount; i++) RL_FREE(state->dirFiles[i]);
-                RL_FREE(state->dirFiles);
-                
-                // Read files in new path
-                state->dirFiles = ReadDirectoryFiles(state->dirPathText, &state->dirFilesCount, state->filterExt);
-                
+                else strcpy(state->dirPathText, TextFormat("%s/%s", state->dirPathText, state->fileNameText));
+
                 strcpy(state->dirPathTextCopy, state->dirPathText);
-                
+
+                // Read files in new path (previous reading cancelled)
+                StartDirectoryScan(state);
+
                 state->filesListActive = -1;
                 strcpy(state->fileNameText, "\0");
                 strcpy(state->fileNameTextCopy, state->fileNameText);
@@ -280,20 +518,20 @@ void GuiFileDialog(GuiFileDialogState *state)
 
             state->prevFilesListActive = state->filesListActive;
         }
-        
+
         GuiLabel((Rectangle){ state->position.x + 10, state->position.y + 245, 68, 25 }, "File name:");
-        
-        if (GuiTextBox((Rectangle){ state->position.x + 75, state->position.y + 245, 275, 25 }, state->fileNameText, 128, state->fileNameEditMode)) 
+
+        if (GuiTextBox((Rectangle){ state->position.x + 75, state->position.y + 245, 275, 25 }, state->fileNameText, 128, state->fileNameEditMode))
         {
             if (state->fileNameText)
             {
                 // Verify if a valid filename has been introduced
                 if (FileExists(TextFormat("%s/%s", state->dirPathText, state->fileNameText)))
                 {
-                    // Select filename from list view
-                    for (int i = 0; i < state->dirFilesCount; i++)
+                    // Select filename from list view (if visible)
+                    for (int i = 0; i < state->dirFilesVisibleCount; i++)
                     {
-                        if (TextIsEqual(state->fileNameText, state->dirFiles[i]))
+                        if (TextIsEqual(state->fileNameText, state->dirFiles[state->dirFilesVisible[i]].name))
                         {
                             state->filesListActive = i;
                             strcpy(state->fileNameTextCopy, state->fileNameText);
@@ -301,104 +539,1104 @@ void GuiFileDialog(GuiFileDialogState *state)
                         }
                     }
                 }
-                else 
+                else
                 {
                     strcpy(state->fileNameText, state->fileNameTextCopy);
                 }
             }
-            
+
             state->fileNameEditMode = !state->fileNameEditMode;
         }
 
         state->fileTypeActive = GuiComboBox((Rectangle){ state->position.x + 75, state->position.y + 275, 275, 25 }, "All files", state->fileTypeActive);
         GuiLabel((Rectangle){ state->position.x + 10, state->position.y + 275, 68, 25 }, "File filter:");
-        
+
         state->SelectFilePressed = GuiButton((Rectangle){ state->position.x + 360, state->position.y + 245, 110, 25 }, "Select");
-        
+
         if (state->SelectFilePressed) state->fileDialogActive = false;
-        
+
         if (GuiButton((Rectangle){ state->position.x + 360, state->position.y + 275, 110, 25 }, "Cancel")) state->fileDialogActive = false;
 
         // File dialog has been closed!
         if (!state->fileDialogActive)
         {
-            // RL_FREE dirFiles memory
-            for (int i = 0; i < state->dirFilesCount; i++) 
-            {
-                RL_FREE(state->dirFiles[i]);
-                RL_FREE(dirFilesIcon[i]);
-            }
-            
-            RL_FREE(state->dirFiles);
-            RL_FREE(dirFilesIcon);
-            
-            dirFilesIcon = NULL;
-            state->dirFiles = NULL;
+            CancelDirectoryScan(state);
+            UnloadDirectoryFiles(state);
         }
     }
 }
 
-// Read all filenames from directory (supported file types)
-static char **ReadDirectoryFiles(const char *dir, int *filesCount, char *filterExt)
+// Unload dialog data (directory entries, thumbnails cache)
+// NOTE: Waits for thumbnails worker threads to finish current decoding
+void UnloadGuiFileDialog(GuiFileDialogState *state)
 {
-    int validFilesCount = 0;
-    char **validFiles = (char **)RL_MALLOC(MAX_DIRECTORY_FILES*sizeof(char *));    // Max files to read
-    for (int i = 0; i < MAX_DIRECTORY_FILES; i++) validFiles[i] = (char *)RL_MALLOC(MAX_DIR_PATH_LENGTH);    // Max file name length
-    
-    int filterExtCount = 0;
-    const char **extensions = GuiTextSplit(filterExt, &filterExtCount, NULL);
-    bool filterExtensions = true;
-    
-    int dirFilesCount = 0;
-    char **files = GetDirectoryFiles(dir, &dirFilesCount);
-    
-    if (TextIsEqual(extensions[0], "all")) filterExtensions = false;
+    CancelDirectoryScan(state);
+    UnloadDirectoryFiles(state);
+
+#if !defined(_WIN32)
+    if (state->thumbnails != NULL) UnloadThumbnailCache((ThumbnailCache *)state->thumbnails);
+#endif
+    state->thumbnails = NULL;
+}
+
+// Start reading state->dirPathText, previous entries are unloaded
+// NOTE: Any reading in progress is cancelled, new entries are added by UpdateDirectoryScan()
+static void StartDirectoryScan(GuiFileDialogState *state)
+{
+    CancelDirectoryScan(state);
+    UnloadDirectoryFiles(state);
+
+    // NOTE: Entries list is allocated even if directory is empty, it marks directory as loaded
+    state->dirFilesCapacity = DIR_FILES_BATCH;
+    state->dirFiles = (GuiFileDialogEntry *)RL_MALLOC(state->dirFilesCapacity*sizeof(GuiFileDialogEntry));
+    state->dirFilesSorted = (int *)RL_MALLOC(state->dirFilesCapacity*sizeof(int));
+    state->dirFilesVisible = (int *)RL_MALLOC(state->dirFilesCapacity*sizeof(int));
+    state->dirFilesText = (const char **)RL_MALLOC(state->dirFilesCapacity*sizeof(const char *));
+    state->filesListScrollIndex = 0;
+
+    if ((state->dirFiles == NULL) || (state->dirFilesSorted == NULL) || (state->dirFilesVisible == NULL) || (state->dirFilesText == NULL))
+    {
+        UnloadDirectoryFiles(state);    // Directory is not loaded, reading is tried again next frame
+        return;
+    }
+
+    // Search text is not kept between directories
+    state->searchEditMode = false;
+    strcpy(state->searchText, "\0");
+    strcpy(state->searchTextCopy, state->searchText);
 
-    for (int i = 0; (i < dirFilesCount) && (validFilesCount < MAX_DIRECTORY_FILES); i++)
+#if defined(_WIN32)
+    // No worker thread available, read directory synchronously
+    int filesCount = 0;
+    char **files = GetDirectoryFiles(state->dirPathText, &filesCount);
+
+    for (int i = 0; i < filesCount; i++)
     {
         if (TextIsEqual(files[i], ".")) continue;
-        
-        if (!filterExtensions)
+
+        struct stat info = { 0 };
+        bool isDirectory = ((stat(TextFormat("%s/%s", state->dirPathText, files[i]), &info) == 0) && S_ISDIR(info.st_mode));
+
+        // Only filter files by extensions, directories should be available
+        if (isDirectory || CheckFileExtension(files[i], state->filterExt))
         {
-            strcpy(validFiles[validFilesCount], files[i]);
-            
-            // Only filter files by extensions, directories should be available
-            if (DirectoryExists(TextFormat("%s\\%s", dir, files[i]))) strcpy(dirFilesIcon[validFilesCount], TextFormat("#%i#%s", 1, files[i]));
-            else 
+            GuiFileDialogEntry entry = LoadFileEntry(files[i], isDirectory, &info);
+
+            // Reading stops on allocation failure, entries already added are kept
+            if ((entry.text == NULL) || !AddDirectoryFiles(state, &entry, 1)) break;
+        }
+    }
+
+    ClearDirectoryFiles();
+#else
+    DirectoryScan *scan = (DirectoryScan *)RL_CALLOC(1, sizeof(DirectoryScan));
+    if (scan == NULL) return;       // Directory listed empty
+
+    strncpy(scan->dirPath, state->dirPathText, MAX_DIR_PATH_LENGTH - 1);
+    strncpy(scan->filterExt, state->filterExt, 255);
+    pthread_mutex_init(&scan->mutex, NULL);
+
+    if (pthread_create(&scan->thread, NULL, DirectoryScanThread, scan) == 0) state->dirScan = scan;
+    else
+    {
+        pthread_mutex_destroy(&scan->mutex);
+        RL_FREE(scan);
+    }
+#endif
+}
+
+#if !defined(_WIN32)
+// Free directory reading and entries not added to dialog
+static void UnloadDirectoryScan(DirectoryScan *scan)
+{
+    for (int i = 0; i < scan->entriesCount; i++) RL_FREE(scan->entries[i].text);
+
+    RL_FREE(scan->entries);
+    pthread_mutex_destroy(&scan->mutex);
+    RL_FREE(scan);
+}
+
+// Add a batch of entries to pending list, returns false if reading has been cancelled or entries could not be added
+// NOTE: Batch entries are unloaded if not added, reading should be stopped
+static bool PushDirectoryScanEntries(DirectoryScan *scan, GuiFileDialogEntry *batch, int count)
+{
+    bool added = false;
+
+    pthread_mutex_lock(&scan->mutex);
+
+    if (!scan->cancelled)
+    {
+        if ((scan->entriesCount + count) > scan->entriesCapacity)
+        {
+            int capacity = (scan->entriesCapacity == 0)? DIR_FILES_BATCH : 2*scan->entriesCapacity;
+            if (capacity < (scan->entriesCount + count)) capacity = scan->entriesCount + count;
+
+            GuiFileDialogEntry *entries = (GuiFileDialogEntry *)RL_REALLOC(scan->entries, capacity*sizeof(GuiFileDialogEntry));
+
+            if (entries != NULL)
             {
-                // TODO: Assign custom filetype icons depending on file extension (image, audio, text, video, models...)
-                
-                if (IsFileExtension(files[i], ".png")) strcpy(dirFilesIcon[validFilesCount], TextFormat("#%i#%s", 12, files[i]));
-                else strcpy(dirFilesIcon[validFilesCount], TextFormat("#%i#%s", 10, files[i]));
+                scan->entries = entries;
+                scan->entriesCapacity = capacity;
             }
+        }
 
-            validFilesCount++;
+        if ((scan->entriesCount + count) <= scan->entriesCapacity)
+        {
+            memcpy(scan->entries + scan->entriesCount, batch, count*sizeof(GuiFileDialogEntry));
+            scan->entriesCount += count;
+            added = true;
         }
-        else
+    }
+
+    pthread_mutex_unlock(&scan->mutex);
+
+    if (!added) for (int i = 0; i < count; i++) RL_FREE(batch[i].text);
+
+    return added;
+}
+
+// Directory reading worker thread
+// NOTE: Only thread-safe functions can be used here, most raylib text and file
+// functions use static buffers (TextFormat(), IsFileExtension(), GetDirectoryFiles()...)
+static void *DirectoryScanThread(void *arg)
+{
+    DirectoryScan *scan = (DirectoryScan *)arg;
+
+    GuiFileDialogEntry batch[DIR_FILES_BATCH] = { 0 };
+    int batchCount = 0;
+    bool cancelled = false;
+
+    DIR *dir = opendir(scan->dirPath);
+
+    if (dir != NULL)
+    {
+        struct dirent *dirEntry = NULL;
+
+        while (!cancelled && ((dirEntry = readdir(dir)) != NULL))
         {
-            for (int j = 0; j < filterExtCount; j++)
-            {
-                // Check file type extensions supported
-                // NOTE: We just store valid files list
-                if (IsFileExtension(files[i], extensions[j]))
-                {
-                    // TODO: Assign custom filetype icons depending on file extension (image, audio, text, video, models...)
+            if (strcmp(dirEntry->d_name, ".") == 0) continue;
 
-                    if (IsFileExtension(files[i], ".png")) strcpy(dirFilesIcon[validFilesCount], TextFormat("#%i#%s", 12, files[i]));
-                    else strcpy(dirFilesIcon[validFilesCount], TextFormat("#%i#%s", 10, files[i]));
-                    
-                    validFilesCount++;
-                }
+            // NOTE: File info is required for sorting by size and date
+            char path[MAX_DIR_PATH_LENGTH + 256] = { 0 };
+            struct stat info = { 0 };
+
+            snprintf(path, sizeof(path), "%s/%s", scan->dirPath, dirEntry->d_name);
+            bool isDirectory = ((stat(path, &info) == 0) && S_ISDIR(info.st_mode));
+
+            // Only filter files by extensions, directories should be available
+            if (!isDirectory && !CheckFileExtension(dirEntry->d_name, scan->filterExt)) continue;
+
+            batch[batchCount] = LoadFileEntry(dirEntry->d_name, isDirectory, &info);
+            if (batch[batchCount].text == NULL) break;      // Allocation failed, reading stops
+            batchCount++;
+
+            if (batchCount == DIR_FILES_BATCH)
+            {
+                cancelled = !PushDirectoryScanEntries(scan, batch, batchCount);
+                batchCount = 0;
             }
         }
+
+        closedir(dir);
     }
-    
-    // TODO: Sort files and directories: dir by name + files by name
 
-    ClearDirectoryFiles();
-    
-    *filesCount = validFilesCount;
-    return validFiles;
+    if (batchCount > 0) PushDirectoryScanEntries(scan, batch, batchCount);
+
+    pthread_mutex_lock(&scan->mutex);
+    scan->finished = true;
+    cancelled = scan->cancelled;
+    pthread_mutex_unlock(&scan->mutex);
+
+    // Reading was cancelled before finishing, dialog does not reference it anymore
+    if (cancelled) UnloadDirectoryScan(scan);
+
+    return NULL;
+}
+#endif
+
+// Add entries read by worker thread to dialog
+// NOTE: Never waits for worker thread, if it is adding entries they are added next frame
+static void UpdateDirectoryScan(GuiFileDialogState *state)
+{
+#if !defined(_WIN32)
+    DirectoryScan *scan = (DirectoryScan *)state->dirScan;
+
+    if ((scan == NULL) || (pthread_mutex_trylock(&scan->mutex) != 0)) return;
+
+    bool added = AddDirectoryFiles(state, scan->entries, scan->entriesCount);
+    scan->entriesCount = 0;
+
+    bool finished = scan->finished;
+
+    pthread_mutex_unlock(&scan->mutex);
+
+    if (finished)
+    {
+        pthread_join(scan->thread, NULL);
+        UnloadDirectoryScan(scan);
+        state->dirScan = NULL;
+    }
+    else if (!added) CancelDirectoryScan(state);    // Allocation failed, entries already added are kept
+#endif
+}
+
+// Cancel directory reading
+// NOTE: Never waits for worker thread (it could be blocked reading a slow directory),
+// it is detached and frees the reading when it stops
+static void CancelDirectoryScan(GuiFileDialogState *state)
+{
+#if !defined(_WIN32)
+    DirectoryScan *scan = (DirectoryScan *)state->dirScan;
+
+    if (scan == NULL) return;
+
+    pthread_t thread = scan->thread;
+
+    pthread_mutex_lock(&scan->mutex);
+    scan->cancelled = true;
+    bool finished = scan->finished;
+    pthread_mutex_unlock(&scan->mutex);
+
+    if (finished)
+    {
+        pthread_join(thread, NULL);
+        UnloadDirectoryScan(scan);
+    }
+    else pthread_detach(thread);
+
+    state->dirScan = NULL;
+#endif
+}
+
+// Unload directory entries
+static void UnloadDirectoryFiles(GuiFileDialogState *state)
+{
+    for (int i = 0; i < state->dirFilesCount; i++) RL_FREE(state->dirFiles[i].text);
+
+    RL_FREE(state->dirFiles);
+    RL_FREE(state->dirFilesSorted);
+    RL_FREE(state->dirFilesVisible);
+    RL_FREE(state->dirFilesText);
+
+    state->dirFiles = NULL;
+    state->dirFilesSorted = NULL;
+    state->dirFilesVisible = NULL;
+    state->dirFilesText = NULL;
+    state->dirFilesCount = 0;
+    state->dirFilesSortedCount = 0;
+    state->dirFilesVisibleCount = 0;
+    state->dirFilesPrefixCount = 0;
+    state->dirFilesCapacity = 0;
+}
+
+// Add entries to dialog, entries text is owned by dialog after this call
+// NOTE: Entries are sorted and filtered by UpdateDirectoryFiles(). On allocation failure entries
+// are unloaded and false is returned (lists keep previous capacity), reading should be stopped
+static bool AddDirectoryFiles(GuiFileDialogState *state, const GuiFileDialogEntry *entries, int count)
+{
+    if (count <= 0) return true;
+
+    if ((state->dirFilesCount + count) > state->dirFilesCapacity)
+    {
+        int capacity = (state->dirFilesCapacity > 0)? state->dirFilesCapacity : DIR_FILES_BATCH;
+        while ((state->dirFilesCount + count) > capacity) capacity *= 2;
+
+        // NOTE: Every list is updated as soon as it grows, so a failure never loses a list
+        GuiFileDialogEntry *files = (GuiFileDialogEntry *)RL_REALLOC(state->dirFiles, capacity*sizeof(GuiFileDialogEntry));
+        if (files != NULL) state->dirFiles = files;
+        int *sorted = (int *)RL_REALLOC(state->dirFilesSorted, capacity*sizeof(int));
+        if (sorted != NULL) state->dirFilesSorted = sorted;
+        int *visible = (int *)RL_REALLOC(state->dirFilesVisible, capacity*sizeof(int));
+        if (visible != NULL) state->dirFilesVisible = visible;
+        const char **text = (const char **)RL_REALLOC(state->dirFilesText, capacity*sizeof(const char *));
+        if (text != NULL) state->dirFilesText = text;
+
+        if ((files == NULL) || (sorted == NULL) || (visible == NULL) || (text == NULL))
+        {
+            for (int i = 0; i < count; i++) RL_FREE(entries[i].text);
+            return false;
+        }
+
+        state->dirFilesCapacity = capacity;
+    }
+
+    memcpy(state->dirFiles + state->dirFilesCount, entries, count*sizeof(GuiFileDialogEntry));
+    state->dirFilesCount += count;
+
+    return true;
+}
+
+// Update sorted and visible entries: new entries read, sort mode or search text changed
+// NOTE: New entries are sorted and merged into sorted list, a new search text starting
+// with previous one only filters entries visible with previous search text
+static void UpdateDirectoryFiles(GuiFileDialogState *state)
+{
+    if (state->dirFiles == NULL) return;
+
+    bool sortChanged = (state->sortModeActive != state->prevSortModeActive);
+    bool entriesAdded = (state->dirFilesSortedCount < state->dirFilesCount);
+    bool searchChanged = !TextIsEqual(state->searchText, state->searchTextCopy);
+
+    if (!sortChanged && !entriesAdded && !searchChanged) return;
+
+    // Keep selected entry selected (if still visible)
+    int activeEntry = -1;
+    if ((state->filesListActive >= 0) && (state->filesListActive < state->dirFilesVisibleCount)) activeEntry = state->dirFilesVisible[state->filesListActive];
+
+    // NOTE: New entries are sorted apart to be merged, all entries are sorted again if that memory is not available
+    int *added = (!sortChanged && entriesAdded)? (int *)RL_MALLOC((state->dirFilesCount - state->dirFilesSortedCount)*sizeof(int)) : NULL;
+
+    if (sortChanged || (entriesAdded && (added == NULL)))
+    {
+        // Sort all entries again, new entries appended to previous sorted order
+        for (int i = state->dirFilesSortedCount; i < state->dirFilesCount; i++) state->dirFilesSorted[i] = i;
+
+        SortFileEntries(state->dirFilesSorted, state->dirFilesCount, state->dirFiles, state->sortModeActive);
+    }
+    else if (entriesAdded)
+    {
+        // Sort new entries and merge them with sorted entries
+        int sortedCount = state->dirFilesSortedCount;
+        int addedCount = state->dirFilesCount - sortedCount;
+
+        for (int i = 0; i < addedCount; i++) added[i] = sortedCount + i;
+
+        SortFileEntries(added, addedCount, state->dirFiles, state->sortModeActive);
+
+        int k = state->dirFilesCount - 1;
+        int i = sortedCount - 1;
+        int j = addedCount - 1;
+
+        // Merge from the end, sorted list has capacity for all entries
+        while (j >= 0)
+        {
+            if ((i >= 0) && (CompareFileEntries(&state->dirFiles[state->dirFilesSorted[i]], &state->dirFiles[added[j]], state->sortModeActive) > 0)) state->dirFilesSorted[k--] = state->dirFilesSorted[i--];
+            else state->dirFilesSorted[k--] = added[j--];
+        }
+
+        RL_FREE(added);
+    }
+
+    state->dirFilesSortedCount = state->dirFilesCount;
+    state->prevSortModeActive = state->sortModeActive;
+
+    // Narrow visible entries if search text only got longer, otherwise filter all entries
+    bool narrow = !sortChanged && !entriesAdded && (strncmp(state->searchText, state->searchTextCopy, strlen(state->searchTextCopy)) == 0);
+
+    FilterDirectoryFiles(state, narrow);
+
+    strcpy(state->searchTextCopy, state->searchText);
+    if (searchChanged) state->filesListScrollIndex = 0;
+
+    // Update selected entry index on visible entries
+    state->filesListActive = -1;
+    for (int i = 0; (activeEntry >= 0) && (i < state->dirFilesVisibleCount); i++)
+    {
+        if (state->dirFilesVisible[i] == activeEntry)
+        {
+            state->filesListActive = i;
+            break;
+        }
+    }
+
+    state->prevFilesListActive = state->filesListActive;
+}
+
+// Filter visible entries by search text
+// NOTE: Entries starting with search text are listed first, then entries containing search text
+// characters in order, both in sort order. If narrowing, only current visible entries are checked
+static void FilterDirectoryFiles(GuiFileDialogState *state, bool narrow)
+{
+    const char *search = state->searchText;
+
+    int *entries = state->dirFilesSorted;
+    int entriesCount = state->dirFilesSortedCount;
+    int prefixCount = entriesCount;     // Entries matching previous search text as prefix (listed first)
+
+    // Nothing visible can not get narrower
+    if (narrow && (state->dirFilesVisibleCount == 0)) return;
+
+    if (narrow)
+    {
+        // NOTE: Visible entries are filtered in place, they are copied to be checked
+        // (all entries are filtered if that memory is not available)
+        int *visible = (int *)RL_MALLOC(state->dirFilesVisibleCount*sizeof(int));
+
+        if (visible != NULL)
+        {
+            memcpy(visible, state->dirFilesVisible, state->dirFilesVisibleCount*sizeof(int));
+            entries = visible;
+            entriesCount = state->dirFilesVisibleCount;
+            prefixCount = state->dirFilesPrefixCount;
+        }
+        else narrow = false;
+    }
+
+    // Fuzzy matching entries, from previous prefix matching entries and from previous fuzzy matching entries
+    // NOTE: Both lists are in sort order, they are merged after filtering. Only prefix
+    // matching entries are listed if fuzzy list memory is not available
+    int *fuzzy = (entriesCount > 0)? (int *)RL_MALLOC(entriesCount*sizeof(int)) : NULL;
+    int fuzzyCount = 0;
+    int fuzzyPrefixCount = 0;
+    int visibleCount = 0;
+
+    for (int i = 0; i < entriesCount; i++)
+    {
+        const GuiFileDialogEntry *entry = &state->dirFiles[entries[i]];
+
+        // NOTE: Parent directory is always available
+        if (TextIsEqual(entry->name, "..") || MatchTextPrefix(entry->name, search)) state->dirFilesVisible[visibleCount++] = entries[i];
+        else if ((fuzzy != NULL) && MatchTextFuzzy(entry->name, search))
+        {
+            fuzzy[fuzzyCount++] = entries[i];
+            if (i < prefixCount) fuzzyPrefixCount++;
+        }
+    }
+
+    state->dirFilesPrefixCount = visibleCount;
+
+    // Merge fuzzy matching entries lists
+    int i = 0;
+    int j = fuzzyPrefixCount;
+
+    while ((i < fuzzyPrefixCount) || (j < fuzzyCount))
+    {
+        if ((j == fuzzyCount) || ((i < fuzzyPrefixCount) && (CompareFileEntries(&state->dirFiles[fuzzy[i]], &state->dirFiles[fuzzy[j]], state->sortModeActive) < 0))) state->dirFilesVisible[visibleCount++] = fuzzy[i++];
+        else state->dirFilesVisible[visibleCount++] = fuzzy[j++];
+    }
+
+    state->dirFilesVisibleCount = visibleCount;
+
+    for (int k = 0; k < state->dirFilesVisibleCount; k++) state->dirFilesText[k] = state->dirFiles[state->dirFilesVisible[k]].text;
+
+    RL_FREE(fuzzy);
+    if (narrow) RL_FREE(entries);
+}
+
+// Compare entries: directories first, parent directory before any other
+static int CompareFileEntries(const GuiFileDialogEntry *entry1, const GuiFileDialogEntry *entry2, int mode)
+{
+    if (entry1->isDirectory != entry2->isDirectory) return entry1->isDirectory? -1 : 1;
+
+    bool parent1 = (strcmp(entry1->name, "..") == 0);
+    bool parent2 = (strcmp(entry2->name, "..") == 0);
+    if (parent1 || parent2) return (int)parent2 - (int)parent1;
+
+    int result = 0;
+
+    if (mode == DIR_FILES_SORT_SIZE) result = (entry1->size < entry2->size) - (entry1->size > entry2->size);
+    else if (mode == DIR_FILES_SORT_DATE) result = (entry1->modTime < entry2->modTime) - (entry1->modTime > entry2->modTime);
+
+    // Name sorting (case insensitive), also used for same size or date entries
+    for (int i = 0; (result == 0) && ((entry1->name[i] != '\0') || (entry2->name[i] != '\0')); i++)
+    {
+        result = tolower((unsigned char)entry1->name[i]) - tolower((unsigned char)entry2->name[i]);
+    }
+
+    if (result == 0) result = strcmp(entry1->name, entry2->name);
+
+    return result;
+}
+
+// Sort entries indices by entries sort mode (heap sort)
+// NOTE: Sorting context is passed explicitly (no globals), so it is reentrant and no memory is required.
+// Order does not need to be stable, CompareFileEntries() never considers two different entries equal
+static void SortFileEntries(int *indices, int count, const GuiFileDialogEntry *entries, int mode)
+{
+    // Build heap, then move its largest entry to the end of unsorted part until sorted
+    for (int i = count/2 - 1; i >= 0; i--) SiftFileEntriesHeap(indices, i, count, entries, mode);
+
+    for (int end = count - 1; end > 0; end--)
+    {
+        int temp = indices[0];
+        indices[0] = indices[end];
+        indices[end] = temp;
+
+        SiftFileEntriesHeap(indices, 0, end, entries, mode);
+    }
+}
+
+// Move entry index down the heap until its children are not greater
+static void SiftFileEntriesHeap(int *indices, int root, int count, const GuiFileDialogEntry *entries, int mode)
+{
+    while ((2*root + 1) < count)
+    {
+        int child = 2*root + 1;
+
+        if (((child + 1) < count) && (CompareFileEntries(&entries[indices[child]], &entries[indices[child + 1]], mode) < 0)) child++;
+        if (CompareFileEntries(&entries[indices[root]], &entries[indices[child]], mode) >= 0) break;
+
+        int temp = indices[root];
+        indices[root] = indices[child];
+        indices[child] = temp;
+        root = child;
+    }
+}
+
+// Check text starts with search (case insensitive)
+static bool MatchTextPrefix(const char *text, const char *search)
+{
+    while ((*search != '\0') && (tolower((unsigned char)*text) == tolower((unsigned char)*search)))
+    {
+        text++;
+        search++;
+    }
+
+    return (*search == '\0');
+}
+
+// Check text contains search characters in order (case insensitive)
+static bool MatchTextFuzzy(const char *text, const char *search)
+{
+    while ((*search != '\0') && (*text != '\0'))
+    {
+        if (tolower((unsigned char)*text) == tolower((unsigned char)*search)) search++;
+        text++;
+    }
+
+    return (*search == '\0');
+}
+
+#if !defined(_WIN32)
+// Unload thumbnails cache: worker threads are stopped, textures unloaded
+// NOTE: Waits for worker threads to finish current decoding
+static void UnloadThumbnailCache(ThumbnailCache *cache)
+{
+    pthread_mutex_lock(&cache->mutex);
+    cache->quit = true;
+    pthread_cond_broadcast(&cache->cond);
+    pthread_mutex_unlock(&cache->mutex);
+
+    for (int i = 0; i < cache->threadsCount; i++) pthread_join(cache->threads[i], NULL);
+
+    for (int i = 0; i < THUMBNAIL_HASH_SIZE; i++)
+    {
+        Thumbnail *thumb = cache->buckets[i];
+
+        while (thumb != NULL)
+        {
+            Thumbnail *next = thumb->next;
+
+            if (thumb->state == THUMBNAIL_READY) UnloadTexture(thumb->texture);
+            else if (thumb->image.data != NULL) UnloadImage(thumb->image);     // Loaded or decoded before quitting
+
+            RL_FREE(thumb->fileName);
+            RL_FREE(thumb);
+            thumb = next;
+        }
+    }
+
+    RL_FREE(cache->jobs);
+    RL_FREE(cache->done);
+    RL_FREE(cache->pending);
+
+    pthread_cond_destroy(&cache->cond);
+    pthread_mutex_destroy(&cache->mutex);
+    RL_FREE(cache);
+}
+
+// Request thumbnail for visible image file, created if not cached
+// NOTE: Thumbnails are requested every frame they are visible, it keeps them cached
+static Thumbnail *RequestThumbnail(ThumbnailCache *cache, const char *fileName, long long modTime)
+{
+    unsigned int hash = 2166136261u;    // FNV-1a, modification time is part of the key
+    for (const char *c = fileName; *c != '\0'; c++) hash = (hash ^ (unsigned char)*c)*16777619u;
+    hash ^= (unsigned int)modTime;
+
+    Thumbnail *thumb = cache->buckets[hash & (THUMBNAIL_HASH_SIZE - 1)];
+
+    while ((thumb != NULL) && ((thumb->hash != hash) || (thumb->modTime != modTime) || (strcmp(thumb->fileName, fileName) != 0))) thumb = thumb->next;
+
+    if (thumb == NULL)
+    {
+        // Queued to worker threads on next cache update
+        // NOTE: On allocation failure thumbnail is not created, it is requested again next frame
+        if (cache->pendingCount == cache->pendingCapacity)
+        {
+            int pendingCapacity = (cache->pendingCapacity == 0)? 32 : 2*cache->pendingCapacity;
+            Thumbnail **pending = (Thumbnail **)RL_REALLOC(cache->pending, pendingCapacity*sizeof(Thumbnail *));
+
+            if (pending == NULL) return NULL;
+
+            cache->pending = pending;
+            cache->pendingCapacity = pendingCapacity;
+        }
+
+        thumb = (Thumbnail *)RL_CALLOC(1, sizeof(Thumbnail));
+        if (thumb == NULL) return NULL;
+
+        thumb->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+
+        if (thumb->fileName == NULL)
+        {
+            RL_FREE(thumb);
+            return NULL;
+        }
+
+        strcpy(thumb->fileName, fileName);
+        thumb->modTime = modTime;
+        thumb->hash = hash;
+        thumb->state = THUMBNAIL_NEW;
+
+        thumb->next = cache->buckets[hash & (THUMBNAIL_HASH_SIZE - 1)];
+        cache->buckets[hash & (THUMBNAIL_HASH_SIZE - 1)] = thumb;
+
+        cache->pending[cache->pendingCount++] = thumb;
+    }
+    else if ((thumb->state >= THUMBNAIL_LOADED) && (thumb != cache->lruFirst))
+    {
+        // Move to front of least recently used list
+        thumb->lruPrev->lruNext = thumb->lruNext;
+        if (thumb->lruNext != NULL) thumb->lruNext->lruPrev = thumb->lruPrev;
+        else cache->lruLast = thumb->lruPrev;
+
+        thumb->lruPrev = NULL;
+        thumb->lruNext = cache->lruFirst;
+        cache->lruFirst->lruPrev = thumb;
+        cache->lruFirst = thumb;
+    }
+
+    thumb->frame = cache->frame;
+
+    return thumb;
+}
+
+// Remove thumbnail from cache and unload it
+// NOTE: Thumbnails being decoded are never removed
+static void RemoveThumbnail(ThumbnailCache *cache, Thumbnail *thumb)
+{
+    Thumbnail **link = &cache->buckets[thumb->hash & (THUMBNAIL_HASH_SIZE - 1)];
+    while (*link != thumb) link = &(*link)->next;
+    *link = thumb->next;
+
+    if (thumb->state >= THUMBNAIL_LOADED)
+    {
+        if (thumb->lruPrev != NULL) thumb->lruPrev->lruNext = thumb->lruNext;
+        else cache->lruFirst = thumb->lruNext;
+
+        if (thumb->lruNext != NULL) thumb->lruNext->lruPrev = thumb->lruPrev;
+        else cache->lruLast = thumb->lruPrev;
+
+        cache->dataSize -= thumb->dataSize;
+    }
+
+    if (thumb->state == THUMBNAIL_READY) UnloadTexture(thumb->texture);
+    else if (thumb->state == THUMBNAIL_LOADED) UnloadImage(thumb->image);
+
+    RL_FREE(thumb->fileName);
+    RL_FREE(thumb);
+}
+
+// Update thumbnails cache: decoded thumbnails are collected and thumbnails requested this frame are
+// queued to worker threads, queued thumbnails not requested anymore are cancelled
+// NOTE: Never waits for worker threads, if they are using the queue it is updated next frame
+static void UpdateThumbnailCache(ThumbnailCache *cache)
+{
+    if (pthread_mutex_trylock(&cache->mutex) != 0) return;
+
+    // Collect decoded thumbnails
+    for (int i = 0; i < cache->doneCount; i++) CacheThumbnail(cache, cache->done[i]);
+
+    cache->doneCount = 0;
+
+    // No worker threads (no thread-safe decoder or threads not created), first queued thumbnail is loaded on main thread
+    if ((cache->threadsCount == 0) && (cache->jobsCount > 0))
+    {
+        Thumbnail *thumb = cache->jobs[0];
+        cache->jobsCount--;
+        memmove(cache->jobs, cache->jobs + 1, cache->jobsCount*sizeof(Thumbnail *));
+
+        thumb->image = LoadThumbnailImage(thumb->fileName);
+        CacheThumbnail(cache, thumb);
+    }
+
+    // Cancel queued thumbnails not visible anymore (scrolled out or directory changed)
+    int jobsCount = 0;
+
+    for (int i = 0; i < cache->jobsCount; i++)
+    {
+        if (cache->jobs[i]->frame == cache->frame) cache->jobs[jobsCount++] = cache->jobs[i];
+        else RemoveThumbnail(cache, cache->jobs[i]);
+    }
+
+    // Queue thumbnails requested this frame
+    // NOTE: Requested thumbnails are only pending if queue was in use on previous frames,
+    // if queue can not grow they are kept pending until next cache update
+    bool queueValid = true;
+
+    if ((jobsCount + cache->pendingCount) > cache->jobsCapacity)
+    {
+        Thumbnail **jobs = (Thumbnail **)RL_REALLOC(cache->jobs, (jobsCount + cache->pendingCount)*sizeof(Thumbnail *));
+
+        if (jobs != NULL)
+        {
+            cache->jobs = jobs;
+            cache->jobsCapacity = jobsCount + cache->pendingCount;
+        }
+        else queueValid = false;
+    }
+
+    if (queueValid)
+    {
+        for (int i = 0; i < cache->pendingCount; i++)
+        {
+            Thumbnail *thumb = cache->pending[i];
+
+            if (thumb->frame == cache->frame)
+            {
+                thumb->state = THUMBNAIL_QUEUED;
+                cache->jobs[jobsCount++] = thumb;
+            }
+            else RemoveThumbnail(cache, thumb);
+        }
+
+        cache->pendingCount = 0;
+    }
+
+    cache->jobsCount = jobsCount;
+
+    if (jobsCount > 0) pthread_cond_broadcast(&cache->cond);
+
+    pthread_mutex_unlock(&cache->mutex);
+
+    // Remove least recently used thumbnails over budget, visible thumbnails are always kept
+    while ((cache->dataSize > GUI_FILE_DIALOG_THUMBNAIL_BUDGET) && (cache->lruLast != NULL) && (cache->lruLast->frame != cache->frame))
+    {
+        RemoveThumbnail(cache, cache->lruLast);
+    }
+}
+
+// Add decoded thumbnail to cache, added to least recently used list
+static void CacheThumbnail(ThumbnailCache *cache, Thumbnail *thumb)
+{
+    thumb->state = (thumb->image.data != NULL)? THUMBNAIL_LOADED : THUMBNAIL_FAILED;
+    thumb->dataSize = (int)sizeof(Thumbnail) + (int)strlen(thumb->fileName) + 1 + thumb->image.width*thumb->image.height*4;
+    cache->dataSize += thumb->dataSize;
+
+    thumb->lruPrev = NULL;
+    thumb->lruNext = cache->lruFirst;
+    if (cache->lruFirst != NULL) cache->lruFirst->lruPrev = thumb;
+    else cache->lruLast = thumb;
+    cache->lruFirst = thumb;
+}
+
+#if defined(GUI_FILE_DIALOG_LOAD_PIXELS)
+// Thumbnails decoding worker thread
+static void *ThumbnailThread(void *arg)
+{
+    ThumbnailCache *cache = (ThumbnailCache *)arg;
+
+    pthread_mutex_lock(&cache->mutex);
+
+    while (!cache->quit)
+    {
+        if (cache->jobsCount == 0)
+        {
+            pthread_cond_wait(&cache->cond, &cache->mutex);
+            continue;
+        }
+
+        // Take first queued thumbnail (visible rows are queued in order)
+        Thumbnail *thumb = cache->jobs[0];
+        cache->jobsCount--;
+        memmove(cache->jobs, cache->jobs + 1, cache->jobsCount*sizeof(Thumbnail *));
+
+        pthread_mutex_unlock(&cache->mutex);
+
+        // NOTE: Thumbnail is only accessed by this thread until it is added to done list
+        thumb->image = LoadThumbnailImage(thumb->fileName);
+
+        pthread_mutex_lock(&cache->mutex);
+
+        if (cache->doneCount == cache->doneCapacity)
+        {
+            int doneCapacity = (cache->doneCapacity == 0)? 32 : 2*cache->doneCapacity;
+            Thumbnail **done = (Thumbnail **)RL_REALLOC(cache->done, doneCapacity*sizeof(Thumbnail *));
+
+            if (done != NULL)
+            {
+                cache->done = done;
+                cache->doneCapacity = doneCapacity;
+            }
+        }
+
+        if (cache->doneCount < cache->doneCapacity) cache->done[cache->doneCount++] = thumb;
+        else
+        {
+            // Done list can not grow: decoded image is discarded, thumbnail stays queued (not drawn)
+            // until the cache is unloaded
+            RL_FREE(thumb->image.data);
+            thumb->image = (Image){ 0 };
+        }
+    }
+
+    pthread_mutex_unlock(&cache->mutex);
+
+    return NULL;
+}
+#endif
+
+// Load thumbnail from image file, decoded and downscaled to thumbnail size (R8G8B8A8)
+// NOTE: Used from worker threads if a thread-safe decoder is available, only thread-safe functions allowed
+static Image LoadThumbnailImage(const char *fileName)
+{
+    Image thumbnail = { 0 };
+
+#if defined(GUI_FILE_DIALOG_LOAD_PIXELS)
+    FILE *imageFile = fopen(fileName, "rb");
+
+    if (imageFile == NULL) return thumbnail;
+
+    fseek(imageFile, 0, SEEK_END);
+    long fileSize = ftell(imageFile);
+    fseek(imageFile, 0, SEEK_SET);
+
+    unsigned char *fileData = (fileSize > 0)? (unsigned char *)RL_MALLOC(fileSize) : NULL;
+
+    if ((fileData != NULL) && (fread(fileData, 1, fileSize, imageFile) != (size_t)fileSize))
+    {
+        RL_FREE(fileData);
+        fileData = NULL;
+    }
+
+    fclose(imageFile);
+
+    if (fileData == NULL) return thumbnail;
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    unsigned char *pixels = GUI_FILE_DIALOG_LOAD_PIXELS(fileData, (int)fileSize, &width, &height, &channels);
+
+    RL_FREE(fileData);
+#else
+    // NOTE: Only used on main thread, raylib image loading is not thread-safe
+    Image image = LoadImage(fileName);
+    if (image.data != NULL) ImageFormat(&image, UNCOMPRESSED_R8G8B8A8);
+
+    unsigned char *pixels = (unsigned char *)image.data;
+    int width = image.width;
+    int height = image.height;
+#endif
+
+    if (pixels == NULL) return thumbnail;
+
+    // Thumbnail size, keeping aspect ratio (images smaller than thumbnail size are not scaled)
+    thumbnail.width = width;
+    thumbnail.height = height;
+
+    if ((width > GUI_FILE_DIALOG_THUMBNAIL_SIZE) || (height > GUI_FILE_DIALOG_THUMBNAIL_SIZE))
+    {
+        if (width >= height)
+        {
+            thumbnail.width = GUI_FILE_DIALOG_THUMBNAIL_SIZE;
+            thumbnail.height = (int)((long long)height*GUI_FILE_DIALOG_THUMBNAIL_SIZE/width);
+        }
+        else
+        {
+            thumbnail.width = (int)((long long)width*GUI_FILE_DIALOG_THUMBNAIL_SIZE/height);
+            thumbnail.height = GUI_FILE_DIALOG_THUMBNAIL_SIZE;
+        }
+
+        if (thumbnail.width < 1) thumbnail.width = 1;
+        if (thumbnail.height < 1) thumbnail.height = 1;
+    }
+
+    thumbnail.data = RL_MALLOC(thumbnail.width*thumbnail.height*4);
+    thumbnail.mipmaps = 1;
+    thumbnail.format = UNCOMPRESSED_R8G8B8A8;
+
+    if (thumbnail.data == NULL) thumbnail = (Image){ 0 };   // Allocation failed, nothing is downscaled (empty size)
+
+    // Downscale: every thumbnail pixel is the average of the image pixels it covers
+    unsigned char *data = (unsigned char *)thumbnail.data;
+
+    for (int y = 0; y < thumbnail.height; y++)
+    {
+        int y0 = (int)((long long)y*height/thumbnail.height);
+        int y1 = (int)((long long)(y + 1)*height/thumbnail.height);
+        if (y1 <= y0) y1 = y0 + 1;
+
+        for (int x = 0; x < thumbnail.width; x++)
+        {
+            int x0 = (int)((long long)x*width/thumbnail.width);
+            int x1 = (int)((long long)(x + 1)*width/thumbnail.width);
+            if (x1 <= x0) x1 = x0 + 1;
+
+            unsigned int sum[4] = { 0 };
+
+            for (int sy = y0; sy < y1; sy++)
+            {
+                const unsigned char *pixel = pixels + ((size_t)sy*width + x0)*4;
+
+                for (int sx = x0; sx < x1; sx++, pixel += 4)
+                {
+                    sum[0] += pixel[0];
+                    sum[1] += pixel[1];
+                    sum[2] += pixel[2];
+                    sum[3] += pixel[3];
+                }
+            }
+
+            unsigned int count = (unsigned int)((y1 - y0)*(x1 - x0));
+
+            for (int c = 0; c < 4; c++) data[(y*thumbnail.width + x)*4 + c] = (unsigned char)(sum[c]/count);
+        }
+    }
+
+#if defined(GUI_FILE_DIALOG_LOAD_PIXELS)
+    GUI_FILE_DIALOG_UNLOAD_PIXELS(pixels);
+#else
+    UnloadImage(image);
+#endif
+
+    return thumbnail;
+}
+
+// Draw thumbnails for visible image entries, requested to thumbnails cache
+// NOTE: Thumbnails are drawn on the right side of list view rows, list view style must be set
+static void DrawThumbnails(GuiFileDialogState *state, Rectangle bounds)
+{
+    ThumbnailCache *cache = (ThumbnailCache *)state->thumbnails;
+
+    if (cache == NULL)
+    {
+        cache = (ThumbnailCache *)RL_CALLOC(1, sizeof(ThumbnailCache));
+        if (cache == NULL) return;
+
+        pthread_mutex_init(&cache->mutex, NULL);
+        pthread_cond_init(&cache->cond, NULL);
+
+#if defined(GUI_FILE_DIALOG_LOAD_PIXELS)
+        for (int i = 0; i < GUI_FILE_DIALOG_THUMBNAIL_THREADS; i++)
+        {
+            if (pthread_create(&cache->threads[cache->threadsCount], NULL, ThumbnailThread, cache) == 0) cache->threadsCount++;
+        }
+#endif
+
+        state->thumbnails = cache;
+    }
+
+    cache->frame++;
+
+    // Visible rows, same layout as GuiListViewEx()
+    int itemsHeight = GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING);
+    int visibleItems = (int)bounds.height/itemsHeight;
+    int startIndex = state->filesListScrollIndex;
+
+    if (visibleItems > (state->dirFilesVisibleCount - startIndex)) visibleItems = state->dirFilesVisibleCount - startIndex;
+
+    Thumbnail *thumbs[64] = { 0 };
+    if (visibleItems > 64) visibleItems = 64;
+
+    for (int i = 0; i < visibleItems; i++)
+    {
+        const GuiFileDialogEntry *entry = &state->dirFiles[state->dirFilesVisible[startIndex + i]];
+
+        if (!entry->isDirectory && CheckFileExtension(entry->name, THUMBNAIL_EXTENSIONS))
+        {
+            char fileName[MAX_DIR_PATH_LENGTH + 256] = { 0 };
+            snprintf(fileName, sizeof(fileName), "%s/%s", state->dirPathText, entry->name);
+
+            thumbs[i] = RequestThumbnail(cache, fileName, entry->modTime);
+        }
+    }
+
+    UpdateThumbnailCache(cache);
+
+    // Upload and draw visible thumbnails
+    float size = (float)GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) - 4;
+    float x = bounds.x + bounds.width - GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) - GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING) - size - 2;
+    float y = bounds.y + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING) + GuiGetStyle(DEFAULT, BORDER_WIDTH) + 2;
+
+    for (int i = 0; i < visibleItems; i++, y += itemsHeight)
+    {
+        Thumbnail *thumb = thumbs[i];
+
+        if (thumb == NULL) continue;
+
+        if (thumb->state == THUMBNAIL_LOADED)
+        {
+            thumb->texture = LoadTextureFromImage(thumb->image);
+            UnloadImage(thumb->image);
+            thumb->image = (Image){ 0 };
+            thumb->state = THUMBNAIL_READY;
+        }
+
+        if (thumb->state == THUMBNAIL_READY)
+        {
+            float scale = size/((thumb->texture.width > thumb->texture.height)? thumb->texture.width : thumb->texture.height);
+            Rectangle dest = { 0 };
+            dest.width = thumb->texture.width*scale;
+            dest.height = thumb->texture.height*scale;
+            dest.x = x + (size - dest.width)/2;
+            dest.y = y + (size - dest.height)/2;
+
+            DrawTexturePro(thumb->texture, (Rectangle){ 0, 0, (float)thumb->texture.width, (float)thumb->texture.height }, dest, (Vector2){ 0, 0 }, 0.0f, Fade(WHITE, guiAlpha));
+        }
+    }
+}
+#endif
+
+// Load directory entry, text includes file type icon
+// NOTE: Used from worker thread, only thread-safe functions allowed
+static GuiFileDialogEntry LoadFileEntry(const char *name, bool isDirectory, const struct stat *info)
+{
+    GuiFileDialogEntry entry = { 0 };
+
+    // TODO: Assign custom filetype icons depending on file extension (image, audio, text, video, models...)
+    int icon = 10;
+    if (isDirectory) icon = 1;
+    else if (CheckFileExtension(name, THUMBNAIL_EXTENSIONS)) icon = 12;
+
+    char iconText[16] = { 0 };
+    int iconTextLength = snprintf(iconText, sizeof(iconText), "#%i#", icon);
+    int nameLength = (int)strlen(name);
+
+    entry.text = (char *)RL_MALLOC(iconTextLength + nameLength + 1);
+    if (entry.text == NULL) return entry;       // Allocation failed, entry text is NULL
+
+    memcpy(entry.text, iconText, iconTextLength);
+    memcpy(entry.text + iconTextLength, name, nameLength + 1);
+
+    entry.name = entry.text + iconTextLength;
+    entry.isDirectory = isDirectory;
+    entry.size = isDirectory? 0 : (long long)info->st_size;
+    entry.modTime = (long long)info->st_mtime;
+
+    return entry;
+}
+
+// Check file extension is included in filter: extensions separated by ';' (case insensitive), "all" for any
+// NOTE: Used from worker thread, raylib IsFileExtension() is not thread-safe
+static bool CheckFileExtension(const char *fileName, const char *filterExt)
+{
+    if (strcmp(filterExt, "all") == 0) return true;
+
+    const char *fileExt = strrchr(fileName, '.');
+
+    if (fileExt == NULL) return false;
+
+    int fileExtLength = (int)strlen(fileExt);
+
+    while (*filterExt != '\0')
+    {
+        int length = 0;
+        while ((filterExt[length] != '\0') && (filterExt[length] != ';')) length++;
+
+        if (length == fileExtLength)
+        {
+            int i = 0;
+            while ((i < length) && (tolower((unsigned char)filterExt[i]) == tolower((unsigned char)fileExt[i]))) i++;
+
+            if (i == length) return true;
+        }
+
+        filterExt += length;
+        if (*filterExt == ';') filterExt++;
+    }
+
+    return false;
 }
 
 #if defined(USE_CUSTOM_LISTVIEW_FILEINFO)
@@ -21,6 +21,11 @@
 #define RAYGUI_SUPPORT_RICONS
 #include "../../src/raygui.h"
 
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+
+#define GUI_LAYOUT_IMPLEMENTATION
+#include "../../src/gui_layout.h"
+
 #include <string.h>             // Required for: strcpy()
 #include <stdlib.h>             // Required for: atoi()
 #include <math.h>               // Required for: round()
@@ -60,6 +65,27 @@ int main()
     
     int headerSizeValue = 0;
     bool headerSizeEditMode = false;
+
+    // Import window layout: file info rows, groups and import button, separated by 15px spacers
+    GuiLayoutItem windowItems[10] = {
+        GuiLayoutFixed(20), GuiLayoutFixed(20), GuiLayoutFixed(15),
+        GuiLayoutFixed(80), GuiLayoutFixed(15), GuiLayoutFixed(160), GuiLayoutFixed(15),
+        GuiLayoutFixed(50), GuiLayoutFlex(1), GuiLayoutFixed(30) };
+    GuiLayoutItem infoItems[2] = { GuiLayoutFixed(75), GuiLayoutFlex(1) };
+
+    // Groups layouts: label, value and units columns
+    GuiLayoutItem valueColumns[3] = { GuiLayoutFixed(40), GuiLayoutFlex(1), GuiLayoutFixed(40) };
+    GuiLayoutItem resolutionRows[3] = { GuiLayoutFixed(25), GuiLayoutFlex(1), GuiLayoutFixed(25) };
+    GuiLayoutItem formatItems[6] = {
+        GuiLayoutFixed(25), GuiLayoutFlex(1), GuiLayoutFixed(20),
+        GuiLayoutFixed(25), GuiLayoutFixed(20), GuiLayoutFixed(25) };
+
+    Rectangle windowCells[10] = { 0 };
+    Rectangle fileCells[2] = { 0 };
+    Rectangle sizeCells[2] = { 0 };
+    Rectangle resolutionCells[9] = { 0 };
+    Rectangle formatCells[6] = { 0 };
+    Rectangle headerCells[3] = { 0 };
     //----------------------------------------------------------------------------------
     
     // Image file info
@@ -182,36 +208,56 @@ int main()
             //----------------------------------------------------------------------------------
             if (importWindowActive)
             {
-                importWindowActive = !GuiWindowBox((Rectangle){ windowOffset.x + 0, windowOffset.y + 0, 200, 465 }, "Image RAW Import Options");
-            
-                GuiLabel((Rectangle){ windowOffset.x + 10, windowOffset.y + 30, 65, 20 }, "Import file:");
-                GuiLabel((Rectangle){ windowOffset.x + 85, windowOffset.y + 30, 75, 20 }, fileName);
-                GuiLabel((Rectangle){ windowOffset.x + 10, windowOffset.y + 50, 65, 20 }, "File size:");
-                GuiLabel((Rectangle){ windowOffset.x + 85, windowOffset.y + 50, 75, 20 }, FormatText("%i bytes", dataSize));
-                GuiGroupBox((Rectangle){ windowOffset.x + 10, windowOffset.y + 85, 180, 80 }, "Resolution");
-                GuiLabel((Rectangle){ windowOffset.x + 20, windowOffset.y + 100, 33, 25 }, "Width:");
-                if (GuiValueBox((Rectangle){ windowOffset.x + 60, windowOffset.y + 100, 80, 25 }, NULL, &widthValue, 0, 8192, widthEditMode)) widthEditMode = !widthEditMode; 
-                GuiLabel((Rectangle){ windowOffset.x + 145, windowOffset.y + 100, 30, 25 }, "pixels");
-                GuiLabel((Rectangle){ windowOffset.x + 20, windowOffset.y + 130, 33, 25 }, "Height:");
-                if (GuiValueBox((Rectangle){ windowOffset.x + 60, windowOffset.y + 130, 80, 25 }, NULL, &heightValue, 0, 8192, heightEditMode)) heightEditMode = !heightEditMode; 
-                GuiLabel((Rectangle){ windowOffset.x + 145, windowOffset.y + 130, 30, 25 }, "pixels");
-                GuiGroupBox((Rectangle){ windowOffset.x + 10, windowOffset.y + 180, 180, 160 }, "Pixel Format");
-                pixelFormatActive = GuiComboBox((Rectangle){ windowOffset.x + 20, windowOffset.y + 195, 160, 25 }, TextJoin(pixelFormatTextList, 8, ";"), pixelFormatActive);
-                GuiLine((Rectangle){ windowOffset.x + 20, windowOffset.y + 220, 160, 20 }, NULL);
-                
+                Rectangle windowBounds = { windowOffset.x, windowOffset.y, 200, 465 };
+                importWindowActive = !GuiWindowBox(windowBounds, "Image RAW Import Options");
+
+                // Layouts are only measured again when window moves or style changes, cells are cached by id
+                GuiLayoutColumn(GuiGetId("importWindow"), (Rectangle){ windowBounds.x + 10, windowBounds.y + 30, 180, 420 }, windowItems, 10, windowCells);
+                GuiLayoutRow(GuiGetId("fileInfo"), windowCells[0], infoItems, 2, fileCells);
+                GuiLayoutRow(GuiGetId("sizeInfo"), windowCells[1], infoItems, 2, sizeCells);
+
+                GuiPushStyle();
+                GuiSetStyle(DEFAULT, LAYOUT_PADDING, 10);
+                GuiLayoutGrid(GuiGetId("resolution"), windowCells[3], valueColumns, 3, resolutionRows, 3, resolutionCells);
+                GuiLayoutColumn(GuiGetId("pixelFormat"), windowCells[5], formatItems, 6, formatCells);
+                GuiLayoutRow(GuiGetId("header"), windowCells[7], valueColumns, 3, headerCells);
+                GuiPopStyle();
+
+                GuiLabel(fileCells[0], "Import file:");
+                GuiLabel(fileCells[1], fileName);
+                GuiLabel(sizeCells[0], "File size:");
+                GuiLabel(sizeCells[1], FormatText("%i bytes", dataSize));
+                GuiGroupBox(windowCells[3], "Resolution");
+                GuiLabel(resolutionCells[0], "Width:");
+                if (GuiValueBox(resolutionCells[1], NULL, &widthValue, 0, 8192, widthEditMode)) widthEditMode = !widthEditMode;
+                GuiLabel(resolutionCells[2], "pixels");
+                GuiLabel(resolutionCells[6], "Height:");
+                if (GuiValueBox(resolutionCells[7], NULL, &heightValue, 0, 8192, heightEditMode)) heightEditMode = !heightEditMode;
+                GuiLabel(resolutionCells[8], "pixels");
+                GuiGroupBox(windowCells[5], "Pixel Format");
+                pixelFormatActive = GuiComboBox(formatCells[0], TextJoin(pixelFormatTextList, 8, ";"), pixelFormatActive);
+                GuiLine(formatCells[1], NULL);
+
+                // NOTE: Toggle groups bounds refer to first toggle, width is shared by toggles
+                int togglePadding = GuiGetStyle(TOGGLE, GROUP_PADDING);
+                Rectangle channelsBounds = formatCells[3];
+                channelsBounds.width = (channelsBounds.width - 3*togglePadding)/4;
+                Rectangle bitDepthBounds = formatCells[5];
+                bitDepthBounds.width = (bitDepthBounds.width - 2*togglePadding)/3;
+
                 if (pixelFormatActive != 0) GuiDisable();
-                GuiLabel((Rectangle){ windowOffset.x + 20, windowOffset.y + 235, 50, 20 }, "Channels:");
-                channelsActive = GuiToggleGroup((Rectangle){ windowOffset.x + 20, windowOffset.y + 255, 156/4, 25 }, TextJoin(channelsTextList, 4, ";"), channelsActive);
-                GuiLabel((Rectangle){ windowOffset.x + 20, windowOffset.y + 285, 50, 20 }, "Bit Depth:");
-                bitDepthActive = GuiToggleGroup((Rectangle){ windowOffset.x + 20, windowOffset.y + 305, 160/3, 25 }, TextJoin(bitDepthTextList, 3, ";"), bitDepthActive);
+                GuiLabel(formatCells[2], "Channels:");
+                channelsActive = GuiToggleGroup(channelsBounds, TextJoin(channelsTextList, 4, ";"), channelsActive);
+                GuiLabel(formatCells[4], "Bit Depth:");
+                bitDepthActive = GuiToggleGroup(bitDepthBounds, TextJoin(bitDepthTextList, 3, ";"), bitDepthActive);
                 GuiEnable();
-                
-                GuiGroupBox((Rectangle){ windowOffset.x + 10, windowOffset.y + 355, 180, 50 }, "Header");
-                GuiLabel((Rectangle){ windowOffset.x + 25, windowOffset.y + 370, 27, 25 }, "Size:");
-                if (GuiValueBox((Rectangle){ windowOffset.x + 55, windowOffset.y + 370, 85, 25 }, NULL, &headerSizeValue, 0, 10000, headerSizeEditMode)) headerSizeEditMode = !headerSizeEditMode; 
-                GuiLabel((Rectangle){ windowOffset.x + 145, windowOffset.y + 370, 30, 25 }, "bytes");
-                
-                btnLoadPressed = GuiButton((Rectangle){ windowOffset.x + 10, windowOffset.y + 420, 180, 30 }, "Import RAW");
+
+                GuiGroupBox(windowCells[7], "Header");
+                GuiLabel(headerCells[0], "Size:");
+                if (GuiValueBox(headerCells[1], NULL, &headerSizeValue, 0, 10000, headerSizeEditMode)) headerSizeEditMode = !headerSizeEditMode;
+                GuiLabel(headerCells[2], "bytes");
+
+                btnLoadPressed = GuiButton(windowCells[9], "Import RAW");
             }
             //----------------------------------------------------------------------------------
 
@@ -222,6 +268,8 @@ int main()
     // De-Initialization
     //--------------------------------------------------------------------------------------
     if (texture.id != 0) UnloadTexture(texture);
+
+    GuiUnloadLayoutCache();
     
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -46,6 +46,7 @@ int main()
     Vector2 panelScroll = { 99, -20 };
     
     bool showContentArea = true;
+    bool itemChecked[10] = { 0 };
     
     SetTargetFPS(60);
     //---------------------------------------------------------------------------------------
@@ -68,9 +69,15 @@ int main()
             
             Rectangle view = GuiScrollPanel(panelRec, panelContentRec, &panelScroll);
             
-            BeginScissorMode(view.x, view.y, view.width, view.height);
+            // Content controls are clipped to panel view, controls fully outside it are skipped
+            GuiBeginClip(view);
                 GuiGrid((Rectangle){panelRec.x + panelScroll.x, panelRec.y + panelScroll.y, panelContentRec.width, panelContentRec.height}, 16, 3);
-            EndScissorMode();
+
+                for (int i = 0; i < 10; i++)
+                {
+                    itemChecked[i] = GuiCheckBox((Rectangle){ panelRec.x + panelScroll.x + 10, panelRec.y + panelScroll.y + 10 + i*30, 20, 20 }, TextFormat("ITEM %02i", i), itemChecked[i]);
+                }
+            GuiEndClip();
             
             if (showContentArea) DrawRectangle(panelRec.x + panelScroll.x, panelRec.y + panelScroll.y, panelContentRec.width, panelContentRec.height, Fade(RED, 0.1));
             
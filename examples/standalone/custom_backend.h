@@ -134,6 +134,18 @@ static void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSi
     // TODO: Draw text limited by a rectangle. This advance function wraps the text inside the rectangle
 }
 
+// USED IN: GuiBeginClip(), GuiEndClip()
+static void BeginScissorMode(int x, int y, int width, int height)
+{
+    // TODO: Limit drawing to the defined screen area (scissor test)
+}
+
+// USED IN: GuiEndClip()
+static void EndScissorMode(void)
+{
+    // TODO: Disable drawing limits (scissor test)
+}
+
 //-------------------------------------------------------------------------------
 // Text required functions
 //-------------------------------------------------------------------------------
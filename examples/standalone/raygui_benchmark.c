@@ -0,0 +1,326 @@
+/*******************************************************************************************
+*
+*   raygui - Controls benchmark (headless)
+*
+*   Every control family is evaluated for a number of frames under scripted input
+*   (mouse sweeping the controls, clicks, wheel and key presses) using the software backend,
+*   no window or GPU required. Reported per control family:
+*
+*       - record ns/ctrl:   Control logic + draw list recording time (GuiBeginFrame() mode, no rasterization)
+*       - draw ns/ctrl:     Control logic + software rasterization time (direct drawing)
+*       - cmds/frame:       Draw commands recorded per frame
+*       - calls/frame:      Backend draw calls per frame
+*       - allocs/frame:     RAYGUI_MALLOC/CALLOC/REALLOC calls per frame (both passes)
+*
+*   USAGE:
+*       raygui_benchmark [frames] [listItems] [textChars]
+*
+*   DEPENDENCIES:
+*       raygui 2.6  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Linux - gcc):
+*       gcc -o raygui_benchmark raygui_benchmark.c -I../../src -std=c99 -D_DEFAULT_SOURCE -O2 -lm
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include <stdio.h>                  // Required for: printf()
+#include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free(), atoi()
+#include <time.h>                   // Required for: clock_gettime(), timespec_get()
+
+// Allocations counter, all raygui allocations go through custom allocators
+static unsigned long long allocationsCount = 0;
+
+static void *CountedMalloc(size_t size) { allocationsCount++; return malloc(size); }
+static void *CountedCalloc(size_t count, size_t size) { allocationsCount++; return calloc(count, size); }
+static void *CountedRealloc(void *ptr, size_t size) { allocationsCount++; return realloc(ptr, size); }
+
+#define RAYGUI_MALLOC(sz)       CountedMalloc(sz)
+#define RAYGUI_CALLOC(n,sz)     CountedCalloc(n,sz)
+#define RAYGUI_REALLOC(p,sz)    CountedRealloc(p,sz)
+#define RAYGUI_FREE(p)          free(p)
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#include "../../src/raygui.h"
+
+#include "software_backend.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define SCREEN_WIDTH              800
+#define SCREEN_HEIGHT             450
+
+#define DEFAULT_FRAMES           2000       // Frames measured per control family and pass
+#define DEFAULT_LIST_ITEMS      10000       // List views items count
+#define DEFAULT_TEXT_CHARS       2000       // GuiTextBoxMulti() text length
+#define WARMUP_FRAMES              60       // Frames run before measuring (caches warm-up)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark case, one per control family
+typedef struct BenchmarkCase {
+    const char *name;               // Control family name
+    Rectangle inputBounds;          // Area swept by scripted mouse
+    int controls;                   // Controls evaluated per frame
+    void (*update)(int frame);      // Evaluate controls for one frame
+} BenchmarkCase;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static int listItemsCount = DEFAULT_LIST_ITEMS;
+static const char **listItems = NULL;
+static char *listItemsData = NULL;
+static int listScrollIndex = 0;
+static int listFocus = -1;
+static int listActive = -1;
+static long long virtualScrollIndex = 0;
+static long long virtualFocus = -1;
+static long long virtualActive = -1;
+
+static int textChars = DEFAULT_TEXT_CHARS;
+static char *multiText = NULL;
+
+static int toggleActive[4] = { 0 };
+static Color pickerColor = { 200, 40, 40, 255 };
+static Vector2 panelScroll = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetTimeNs(void);                      // Get monotonic time in nanoseconds
+static void ScriptInput(int frame, Rectangle bounds);   // Set frame scripted input
+
+static void UpdateButtons(int frame);
+static void UpdateToggleGroups(int frame);
+static void UpdateListView(int frame);
+static void UpdateListViewVirtual(int frame);
+static void UpdateTextBoxMulti(int frame);
+static void UpdateColorPicker(int frame);
+static void UpdateGrid(int frame);
+static void UpdateScrollPanel(int frame);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    int frames = (argc > 1)? atoi(argv[1]) : DEFAULT_FRAMES;
+    if (argc > 2) listItemsCount = atoi(argv[2]);
+    if (argc > 3) textChars = atoi(argv[3]);
+
+    if ((frames <= 0) || (listItemsCount <= 0) || (textChars <= 0))
+    {
+        printf("USAGE: raygui_benchmark [frames] [listItems] [textChars]\n");
+        return 1;
+    }
+
+    if (!InitSoftwareBackend(SCREEN_WIDTH, SCREEN_HEIGHT)) return 1;
+
+    // List items text
+    listItems = (const char **)malloc(listItemsCount*sizeof(const char *));
+    listItemsData = (char *)malloc(listItemsCount*16);
+    for (int i = 0; i < listItemsCount; i++)
+    {
+        snprintf(listItemsData + i*16, 16, "Item %i", i);
+        listItems[i] = listItemsData + i*16;
+    }
+
+    // Multiline text, words of different lengths
+    const char *words = "lorem ipsum dolor sit amet consectetur adipiscing elit sed do eiusmod tempor ";
+    int wordsLength = (int)strlen(words);
+    multiText = (char *)malloc(textChars + 1);
+    for (int i = 0; i < textChars; i++) multiText[i] = words[i%wordsLength];
+    multiText[textChars] = '\0';
+
+    char listName[32] = { 0 };
+    char virtualName[32] = { 0 };
+    char textName[32] = { 0 };
+    snprintf(listName, 32, "ListView (%i)", listItemsCount);
+    snprintf(virtualName, 32, "ListViewVirtual (%i)", listItemsCount);
+    snprintf(textName, 32, "TextBoxMulti (%i)", textChars);
+
+    BenchmarkCase cases[] = {
+        { "Button", { 20, 20, 760, 200 }, 20, UpdateButtons },
+        { "ToggleGroup", { 20, 20, 500, 170 }, 4, UpdateToggleGroups },
+        { listName, { 20, 20, 300, 400 }, 1, UpdateListView },
+        { virtualName, { 20, 20, 300, 400 }, 1, UpdateListViewVirtual },
+        { textName, { 20, 20, 500, 400 }, 1, UpdateTextBoxMulti },
+        { "ColorPicker", { 20, 20, 230, 200 }, 1, UpdateColorPicker },
+        { "Grid", { 20, 20, 760, 410 }, 1, UpdateGrid },
+        { "ScrollPanel", { 20, 20, 400, 300 }, 1, UpdateScrollPanel },
+    };
+    int casesCount = sizeof(cases)/sizeof(BenchmarkCase);
+    //---------------------------------------------------------------------------------------
+
+    printf("raygui benchmark: %i frames per pass, %ix%i software framebuffer\n\n", frames, SCREEN_WIDTH, SCREEN_HEIGHT);
+    printf("%-24s %8s %15s %15s %11s %12s %13s\n", "control", "ctrls", "record ns/ctrl", "draw ns/ctrl", "cmds/frame", "calls/frame", "allocs/frame");
+
+    for (int c = 0; c < casesCount; c++)
+    {
+        BenchmarkCase *bench = &cases[c];
+        int commandsCount = 0;
+
+        // Warm-up: caches, draw list storage and style initialization
+        for (int frame = 0; frame < WARMUP_FRAMES; frame++)
+        {
+            BeginSoftwareFrame();
+            ScriptInput(frame, bench->inputBounds);
+            GuiBeginFrame();
+            bench->update(frame);
+            GuiEndFrame();
+        }
+
+        allocationsCount = 0;
+
+        // Pass 1: Record draw list, controls logic only (draw list submitted out of timing)
+        double recordTime = 0.0;
+        for (int frame = 0; frame < frames; frame++)
+        {
+            BeginSoftwareFrame();
+            ScriptInput(frame, bench->inputBounds);
+
+            double start = GetTimeNs();
+            GuiBeginFrame();
+            bench->update(frame);
+            recordTime += GetTimeNs() - start;
+
+            GuiGetDrawCommands(&commandsCount);
+            GuiEndFrame();
+        }
+
+        // Pass 2: Direct drawing, controls logic and rasterization
+        double drawTime = 0.0;
+        unsigned long long drawCalls = 0;
+        for (int frame = 0; frame < frames; frame++)
+        {
+            BeginSoftwareFrame();
+            ScriptInput(frame, bench->inputBounds);
+
+            double start = GetTimeNs();
+            bench->update(frame);
+            drawTime += GetTimeNs() - start;
+
+            drawCalls += GetDrawCallsCount();
+        }
+
+        printf("%-24s %8i %15.1f %15.1f %11i %12.1f %13.2f\n", bench->name, bench->controls,
+               recordTime/((double)frames*bench->controls), drawTime/((double)frames*bench->controls),
+               commandsCount, (double)drawCalls/frames, (double)allocationsCount/(2.0*frames));
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(listItems);
+    free(listItemsData);
+    free(multiText);
+
+    CloseSoftwareBackend();
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+
+// Get monotonic time in nanoseconds
+static double GetTimeNs(void)
+{
+    struct timespec ts = { 0 };
+
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+
+    return (double)ts.tv_sec*1e9 + (double)ts.tv_nsec;
+}
+
+// Set frame scripted input: mouse sweeps bounds, left button clicks every 8 frames
+// (pressed for 2 frames), wheel moves down and up every 15 frames, a key is pressed every 16 frames
+static void ScriptInput(int frame, Rectangle bounds)
+{
+    SetMousePosition(bounds.x + (frame*37)%bounds.width, bounds.y + (frame*53)%bounds.height);
+    SetMouseButtonState(MOUSE_LEFT_BUTTON, (frame%8) >= 6);
+    SetMouseWheelMove(((frame%30) == 0)? -1 : (((frame%30) == 15)? 1 : 0));
+    SetKeyState(KEY_BACKSPACE, (frame%16) == 8);
+
+    if ((frame%16) == 0) PushKeyPressed('a' + (frame/16)%26);
+}
+
+// 20 buttons, 5 columns by 4 rows
+static void UpdateButtons(int frame)
+{
+    (void)frame;
+
+    for (int i = 0; i < 20; i++) GuiButton(RAYGUI_CLITERAL(Rectangle){ 20 + (i%5)*152, 20 + (i/5)*50, 140, 40 }, "Button");
+}
+
+// 4 toggle groups of 5 toggles
+static void UpdateToggleGroups(int frame)
+{
+    (void)frame;
+
+    for (int i = 0; i < 4; i++) toggleActive[i] = GuiToggleGroup(RAYGUI_CLITERAL(Rectangle){ 20, 20 + i*40, 96, 30 }, "ONE;TWO;THREE;FOUR;FIVE", toggleActive[i]);
+}
+
+static void UpdateListView(int frame)
+{
+    (void)frame;
+
+    listActive = GuiListViewEx(RAYGUI_CLITERAL(Rectangle){ 20, 20, 300, 400 }, listItems, listItemsCount, &listFocus, &listScrollIndex, listActive, false);
+}
+
+static const char *GetListItem(long long index, void *userData)
+{
+    (void)userData;
+
+    return listItems[index];
+}
+
+static void UpdateListViewVirtual(int frame)
+{
+    (void)frame;
+
+    virtualActive = GuiListViewVirtual(RAYGUI_CLITERAL(Rectangle){ 20, 20, 300, 400 }, listItemsCount, GetListItem, NULL, &virtualFocus, &virtualScrollIndex, virtualActive);
+}
+
+// Text box always in edit mode, scripted key presses are introduced (when text fits)
+static void UpdateTextBoxMulti(int frame)
+{
+    (void)frame;
+
+    GuiTextBoxMulti(RAYGUI_CLITERAL(Rectangle){ 20, 20, 500, 400 }, multiText, textChars + 1, true);
+}
+
+static void UpdateColorPicker(int frame)
+{
+    (void)frame;
+
+    pickerColor = GuiColorPicker(RAYGUI_CLITERAL(Rectangle){ 20, 20, 200, 200 }, pickerColor);
+}
+
+static void UpdateGrid(int frame)
+{
+    (void)frame;
+
+    GuiGrid(RAYGUI_CLITERAL(Rectangle){ 20, 20, 760, 410 }, 20.0f, 2);
+}
+
+static void UpdateScrollPanel(int frame)
+{
+    (void)frame;
+
+    GuiScrollPanel(RAYGUI_CLITERAL(Rectangle){ 20, 20, 400, 300 }, RAYGUI_CLITERAL(Rectangle){ 20, 20, 800, 1200 }, &panelScroll);
+}
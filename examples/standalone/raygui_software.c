@@ -0,0 +1,91 @@
+/*******************************************************************************************
+*
+*   raygui - Standalone mode with software backend (headless)
+*
+*   Controls are drawn into an in-memory framebuffer with scripted input,
+*   no window or GPU required, last frame is exported to a PPM image
+*
+*   DEPENDENCIES:
+*       raygui 2.6  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Linux - gcc):
+*       gcc -o raygui_software raygui_software.c -I../../src -std=c99 -lm
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#define RAYGUI_IMPLEMENTATION
+#define RAYGUI_STANDALONE
+#include "../../src/raygui.h"
+
+#include "software_backend.h"
+
+#define SCREEN_WIDTH    400
+#define SCREEN_HEIGHT   300
+#define FRAMES_COUNT     60
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    if (!InitSoftwareBackend(SCREEN_WIDTH, SCREEN_HEIGHT)) return 1;
+
+    bool checked = false;
+    bool dropdownEditMode = false;
+    int dropdownActive = 0;
+    int toggleActive = 0;
+    float sliderValue = 50.0f;
+    int clicks = 0;
+    char text[64] = "Edit me";
+    bool textEditMode = false;
+    Color color = { 200, 40, 40, 255 };
+    //---------------------------------------------------------------------------------------
+
+    // Main loop: scripted input over a fixed number of frames
+    for (int frame = 0; frame < FRAMES_COUNT; frame++)
+    {
+        // Input
+        //----------------------------------------------------------------------------------
+        BeginSoftwareFrame();
+
+        // Click the button on frames 10-11, then the checkbox on frames 20-21
+        if (frame < 20) SetMousePosition(60, 30);
+        else if (frame < 30) SetMousePosition(25, 70);
+        else SetMousePosition(260, 140);     // Hover color picker
+
+        SetMouseButtonState(MOUSE_LEFT_BUTTON, (frame == 10) || (frame == 20));
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+        if (GuiButton((Rectangle){ 20, 20, 120, 24 }, "Button")) clicks++;
+        checked = GuiCheckBox((Rectangle){ 20, 60, 20, 20 }, "Check me!", checked);
+        toggleActive = GuiToggleGroup((Rectangle){ 20, 100, 60, 24 }, "ONE;TWO;THREE", toggleActive);
+        sliderValue = GuiSliderBar((Rectangle){ 60, 140, 120, 20 }, "Value", TextFormat("%i", (int)sliderValue), sliderValue, 0, 100);
+        if (GuiTextBox((Rectangle){ 20, 180, 160, 24 }, text, 64, textEditMode)) textEditMode = !textEditMode;
+        color = GuiColorPicker((Rectangle){ 220, 20, 140, 140 }, color);
+        GuiLabel((Rectangle){ 20, 220, 360, 20 }, TextFormat("Clicks: %i - Draw calls: %i", clicks, GetDrawCallsCount()));
+
+        if (GuiDropdownBox((Rectangle){ 220, 180, 140, 24 }, "RED;GREEN;BLUE", &dropdownActive, dropdownEditMode)) dropdownEditMode = !dropdownEditMode;
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    bool exported = ExportFramebuffer((argc > 1)? argv[1] : "raygui_software.ppm");
+
+    CloseSoftwareBackend();
+    //--------------------------------------------------------------------------------------
+
+    printf("Clicks: %i, checked: %s\n", clicks, checked? "true" : "false");
+
+    return exported? 0 : 1;
+}
@@ -0,0 +1,1001 @@
+/*******************************************************************************************
+*
+*   raygui - Standalone mode software backend
+*
+*   Headless backend for raygui standalone mode: all required drawing functions are
+*   rasterized on CPU into an in-memory RGBA framebuffer and input is scripted by the
+*   program, no window or GPU is required (useful for automated testing and CI)
+*
+*   FEATURES:
+*       - RGBA framebuffer with scissor support and alpha blending (src-over)
+*       - Rectangle spans filled with SSE2 (4 pixels per iteration), scalar fallback
+*       - Gradients, triangles, textures and text with an embedded 5x7 bitmap font
+*       - Scripted input: mouse position/buttons/wheel, keys state and key presses queue
+*       - Draw calls counter and framebuffer export to PPM image
+*
+*   USAGE:
+*       #define RAYGUI_IMPLEMENTATION
+*       #define RAYGUI_STANDALONE
+*       #include "raygui.h"
+*
+*       #include "software_backend.h"
+*
+*       InitSoftwareBackend(800, 450);
+*
+*       // Frame loop
+*       BeginSoftwareFrame();       // Previous frame input state latched, required for pressed/released
+*       SetMousePosition(x, y);     // Script input for current frame
+*       SetMouseButtonState(MOUSE_LEFT_BUTTON, true);
+*
+*       ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+*       GuiButton(...);             // Use raygui API
+*
+*       ExportFramebuffer("frame.ppm");
+*       CloseSoftwareBackend();
+*
+*   NOTE: Font data can not be loaded in standalone mode (Font/CharInfo are opaque for the backend),
+*   all text is rendered with the embedded bitmap font, scaled (nearest) from its base size (10 pixels)
+*
+*   NOTE: Backend functions are declared static inline, programs only using part of the API
+*   compile warning-free (-Wall -Wextra)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include <stdio.h>              // Required for: FILE, fopen(), fwrite(), fclose()
+#include <stdlib.h>             // Required for: malloc(), calloc(), free()
+#include <string.h>             // Required for: memcpy(), strrchr()
+#include <math.h>               // Required for: floorf(), ceilf()
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define SOFTWARE_BACKEND_SSE2
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define SOFTWARE_MAX_TEXTURES           64      // Maximum textures loaded at the same time
+#define SOFTWARE_MAX_KEYS              512      // Maximum key code tracked
+#define SOFTWARE_MAX_MOUSE_BUTTONS       3      // Left, right and middle buttons
+#define SOFTWARE_MAX_KEY_PRESSED_QUEUE  16      // Maximum key presses per frame
+
+#define SOFTWARE_FONT_BASE_SIZE         10      // Embedded font cell height (1 top row, 7 glyph rows, 2 descender rows)
+#define SOFTWARE_FONT_GLYPH_WIDTH        5      // Embedded font glyph width
+#define SOFTWARE_FONT_GLYPH_ROWS         9      // Embedded font glyph rows stored (cell rows 1..9)
+#define SOFTWARE_FONT_ADVANCE            6      // Embedded font glyph advance (glyph width + 1 pixel gap)
+#define SOFTWARE_FONT_FIRST_CHAR        32      // Embedded font first character (space)
+#define SOFTWARE_FONT_CHARS_COUNT       95      // Embedded font characters count (ASCII 32..126)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Texture data registered on backend
+typedef struct SoftwareTexture {
+    Color *pixels;                  // Texture pixels (RGBA), NULL if slot is free
+    int width;                      // Texture width
+    int height;                     // Texture height
+} SoftwareTexture;
+
+// Software backend state
+typedef struct SoftwareBackend {
+    Color *pixels;                  // Framebuffer pixels (RGBA)
+    int width;                      // Framebuffer width
+    int height;                     // Framebuffer height
+    Rectangle scissor;              // Current scissor area, clipped to framebuffer
+
+    Vector2 mousePosition;                                  // Mouse position, scripted
+    int mouseWheelMove;                                     // Mouse wheel movement, reset every frame
+    bool mouseButtons[SOFTWARE_MAX_MOUSE_BUTTONS];          // Mouse buttons state, current frame
+    bool mouseButtonsPrevious[SOFTWARE_MAX_MOUSE_BUTTONS];  // Mouse buttons state, previous frame
+    bool keys[SOFTWARE_MAX_KEYS];                           // Keys state, current frame
+    bool keysPrevious[SOFTWARE_MAX_KEYS];                   // Keys state, previous frame
+    int keyPressedQueue[SOFTWARE_MAX_KEY_PRESSED_QUEUE];    // Key presses (characters) queue, reset every frame
+    int keyPressedCount;                                    // Key presses queued
+    int keyPressedIndex;                                    // Next key press returned by GetKeyPressed()
+
+    SoftwareTexture textures[SOFTWARE_MAX_TEXTURES];        // Textures registered, texture id is slot index + 1
+
+    unsigned int drawCalls;         // Draw calls since BeginSoftwareFrame()
+} SoftwareBackend;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static SoftwareBackend backend = { 0 };
+
+// Embedded font glyphs, ASCII 32..126, 5x9 bits per glyph (bit 4 is the leftmost pixel)
+// NOTE: Glyphs use rows 0..6 (cap height), rows 7..8 are descenders
+static const unsigned char softwareFontGlyphs[SOFTWARE_FONT_CHARS_COUNT][SOFTWARE_FONT_GLYPH_ROWS] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ' '
+    { 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },   // '!'
+    { 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '"'
+    { 0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a, 0x00, 0x00 },   // '#'
+    { 0x04, 0x0f, 0x14, 0x0e, 0x05, 0x1e, 0x04, 0x00, 0x00 },   // '$'
+    { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03, 0x00, 0x00 },   // '%'
+    { 0x0c, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0d, 0x00, 0x00 },   // '&'
+    { 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '\''
+    { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00, 0x00 },   // '('
+    { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00, 0x00 },   // ')'
+    { 0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00, 0x00, 0x00 },   // '*'
+    { 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00 },   // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x04, 0x08 },   // ','
+    { 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00 },   // '.'
+    { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00 },   // '/'
+    { 0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e, 0x00, 0x00 },   // '0'
+    { 0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },   // '1'
+    { 0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f, 0x00, 0x00 },   // '2'
+    { 0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e, 0x00, 0x00 },   // '3'
+    { 0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02, 0x00, 0x00 },   // '4'
+    { 0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },   // '5'
+    { 0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e, 0x00, 0x00 },   // '6'
+    { 0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08, 0x00, 0x00 },   // '7'
+    { 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00 },   // '8'
+    { 0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c, 0x00, 0x00 },   // '9'
+    { 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00 },   // ':'
+    { 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x04, 0x08, 0x00 },   // ';'
+    { 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00 },   // '<'
+    { 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },   // '='
+    { 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x00, 0x00 },   // '>'
+    { 0x0e, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04, 0x00, 0x00 },   // '?'
+    { 0x0e, 0x11, 0x01, 0x0d, 0x15, 0x15, 0x0e, 0x00, 0x00 },   // '@'
+    { 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },   // 'A'
+    { 0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e, 0x00, 0x00 },   // 'B'
+    { 0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },   // 'C'
+    { 0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c, 0x00, 0x00 },   // 'D'
+    { 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00, 0x00 },   // 'E'
+    { 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10, 0x00, 0x00 },   // 'F'
+    { 0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f, 0x00, 0x00 },   // 'G'
+    { 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },   // 'H'
+    { 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },   // 'I'
+    { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c, 0x00, 0x00 },   // 'J'
+    { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11, 0x00, 0x00 },   // 'K'
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00 },   // 'L'
+    { 0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00 },   // 'M'
+    { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 },   // 'N'
+    { 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },   // 'O'
+    { 0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10, 0x00, 0x00 },   // 'P'
+    { 0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d, 0x00, 0x00 },   // 'Q'
+    { 0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11, 0x00, 0x00 },   // 'R'
+    { 0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e, 0x00, 0x00 },   // 'S'
+    { 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },   // 'T'
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },   // 'U'
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00 },   // 'V'
+    { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a, 0x00, 0x00 },   // 'W'
+    { 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },   // 'X'
+    { 0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00, 0x00 },   // 'Y'
+    { 0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f, 0x00, 0x00 },   // 'Z'
+    { 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00, 0x00 },   // '['
+    { 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00 },   // '\\'
+    { 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00, 0x00 },   // ']'
+    { 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '^'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00 },   // '_'
+    { 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '`'
+    { 0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x0f, 0x00, 0x00 },   // 'a'
+    { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1e, 0x00, 0x00 },   // 'b'
+    { 0x00, 0x00, 0x0e, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },   // 'c'
+    { 0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f, 0x00, 0x00 },   // 'd'
+    { 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x10, 0x0e, 0x00, 0x00 },   // 'e'
+    { 0x06, 0x09, 0x08, 0x1c, 0x08, 0x08, 0x08, 0x00, 0x00 },   // 'f'
+    { 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x11, 0x0e },   // 'g'
+    { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00, 0x00 },   // 'h'
+    { 0x04, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },   // 'i'
+    { 0x02, 0x00, 0x06, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c },   // 'j'
+    { 0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12, 0x00, 0x00 },   // 'k'
+    { 0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },   // 'l'
+    { 0x00, 0x00, 0x1a, 0x15, 0x15, 0x11, 0x11, 0x00, 0x00 },   // 'm'
+    { 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11, 0x00, 0x00 },   // 'n'
+    { 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },   // 'o'
+    { 0x00, 0x00, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10 },   // 'p'
+    { 0x00, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },   // 'q'
+    { 0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10, 0x00, 0x00 },   // 'r'
+    { 0x00, 0x00, 0x0f, 0x10, 0x0e, 0x01, 0x1e, 0x00, 0x00 },   // 's'
+    { 0x08, 0x08, 0x1c, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 },   // 't'
+    { 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0d, 0x00, 0x00 },   // 'u'
+    { 0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00 },   // 'v'
+    { 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },   // 'w'
+    { 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },   // 'x'
+    { 0x00, 0x00, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x11, 0x0e },   // 'y'
+    { 0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x1f, 0x00, 0x00 },   // 'z'
+    { 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x00, 0x00 },   // '{'
+    { 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },   // '|'
+    { 0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, 0x00, 0x00 },   // '}'
+    { 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00 },   // '~'
+};
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void FillSpan(Color *dst, int count, Color color);         // Fill pixels span with color (alpha blended)
+static void BlendPixel(Color *dst, Color color);                  // Blend color over pixel (src-over)
+static void FillRectangle(int x, int y, int width, int height, Color color);   // Fill rectangle clipped to scissor
+static Color ColorTint(Color color, Color tint);                  // Multiply color by tint
+static void DrawGlyph(int glyph, float posX, float posY, float scale, Rectangle clip, Color tint);     // Draw embedded font glyph
+static int GetCodepointGlyph(const char *text, int *bytesProcessed);  // Get glyph index for next codepoint in text
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Backend management
+//----------------------------------------------------------------------------------
+
+// Initialize software backend framebuffer
+static inline bool InitSoftwareBackend(int width, int height)
+{
+    memset(&backend, 0, sizeof(SoftwareBackend));
+
+    if ((width <= 0) || (height <= 0)) return false;
+
+    backend.pixels = (Color *)calloc(width*height, sizeof(Color));
+    if (backend.pixels == NULL) return false;
+
+    backend.width = width;
+    backend.height = height;
+    backend.scissor = RAYGUI_CLITERAL(Rectangle){ 0, 0, width, height };
+
+    return true;
+}
+
+// Close software backend, framebuffer and textures are unloaded
+static inline void CloseSoftwareBackend(void)
+{
+    for (int i = 0; i < SOFTWARE_MAX_TEXTURES; i++) free(backend.textures[i].pixels);
+    free(backend.pixels);
+
+    memset(&backend, 0, sizeof(SoftwareBackend));
+}
+
+// Begin new frame: input state of previous frame is latched (required to detect pressed/released),
+// mouse wheel, key presses queue and draw calls counter are reset
+// NOTE: Input for the new frame must be scripted after calling this function
+static inline void BeginSoftwareFrame(void)
+{
+    memcpy(backend.mouseButtonsPrevious, backend.mouseButtons, sizeof(backend.mouseButtons));
+    memcpy(backend.keysPrevious, backend.keys, sizeof(backend.keys));
+
+    backend.mouseWheelMove = 0;
+    backend.keyPressedCount = 0;
+    backend.keyPressedIndex = 0;
+    backend.drawCalls = 0;
+}
+
+// Get framebuffer pixels (RGBA)
+static inline const Color *GetFramebuffer(int *width, int *height)
+{
+    if (width != NULL) *width = backend.width;
+    if (height != NULL) *height = backend.height;
+
+    return backend.pixels;
+}
+
+// Get draw calls since BeginSoftwareFrame()
+static inline unsigned int GetDrawCallsCount(void)
+{
+    return backend.drawCalls;
+}
+
+// Export framebuffer to PPM image file (binary, alpha discarded)
+static inline bool ExportFramebuffer(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL) return false;
+
+    fprintf(file, "P6\n%i %i\n255\n", backend.width, backend.height);
+
+    unsigned char *row = (unsigned char *)malloc(backend.width*3);
+    bool success = (row != NULL);
+
+    for (int y = 0; success && (y < backend.height); y++)
+    {
+        const Color *src = backend.pixels + y*backend.width;
+
+        for (int x = 0; x < backend.width; x++)
+        {
+            row[x*3] = src[x].r;
+            row[x*3 + 1] = src[x].g;
+            row[x*3 + 2] = src[x].b;
+        }
+
+        success = (fwrite(row, 3, backend.width, file) == (size_t)backend.width);
+    }
+
+    free(row);
+    fclose(file);
+
+    return success;
+}
+
+// Clear framebuffer (scissor area is ignored)
+static inline void ClearBackground(Color color)
+{
+    Color *pixels = backend.pixels;
+    int count = backend.width*backend.height;
+
+#if defined(SOFTWARE_BACKEND_SSE2)
+    int packed = 0;
+    memcpy(&packed, &color, sizeof(int));
+    __m128i color4 = _mm_set1_epi32(packed);
+
+    for (; count >= 4; count -= 4, pixels += 4) _mm_storeu_si128((__m128i *)pixels, color4);
+#endif
+    while (count-- > 0) *pixels++ = color;
+}
+
+// Begin scissor mode, drawing is limited to the defined area
+static inline void BeginScissorMode(int x, int y, int width, int height)
+{
+    int x1 = x + width;
+    int y1 = y + height;
+
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > backend.width) x1 = backend.width;
+    if (y1 > backend.height) y1 = backend.height;
+
+    backend.scissor = RAYGUI_CLITERAL(Rectangle){ x, y, (x1 > x)? x1 - x : 0, (y1 > y)? y1 - y : 0 };
+}
+
+// End scissor mode
+static inline void EndScissorMode(void)
+{
+    backend.scissor = RAYGUI_CLITERAL(Rectangle){ 0, 0, backend.width, backend.height };
+}
+
+// Load texture from pixels data (RGBA), data is copied
+// NOTE: Returned texture id is 0 on failure
+static inline Texture2D LoadTextureFromData(const Color *pixels, int width, int height)
+{
+    Texture2D texture = { 0 };
+
+    if ((pixels == NULL) || (width <= 0) || (height <= 0)) return texture;
+
+    for (int i = 0; i < SOFTWARE_MAX_TEXTURES; i++)
+    {
+        if (backend.textures[i].pixels == NULL)
+        {
+            backend.textures[i].pixels = (Color *)malloc(width*height*sizeof(Color));
+            if (backend.textures[i].pixels == NULL) break;
+
+            memcpy(backend.textures[i].pixels, pixels, width*height*sizeof(Color));
+            backend.textures[i].width = width;
+            backend.textures[i].height = height;
+
+            texture.id = i + 1;
+            texture.width = width;
+            texture.height = height;
+            texture.mipmaps = 1;
+            break;
+        }
+    }
+
+    return texture;
+}
+
+// Unload texture data from backend
+static inline void UnloadTexture(Texture2D texture)
+{
+    if ((texture.id > 0) && (texture.id <= SOFTWARE_MAX_TEXTURES))
+    {
+        free(backend.textures[texture.id - 1].pixels);
+        backend.textures[texture.id - 1].pixels = NULL;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Scripted input
+//----------------------------------------------------------------------------------
+
+// Set mouse position
+static inline void SetMousePosition(int x, int y)
+{
+    backend.mousePosition = RAYGUI_CLITERAL(Vector2){ (float)x, (float)y };
+}
+
+// Set mouse button state (down or up) for current frame
+static inline void SetMouseButtonState(int button, bool down)
+{
+    if ((button >= 0) && (button < SOFTWARE_MAX_MOUSE_BUTTONS)) backend.mouseButtons[button] = down;
+}
+
+// Set mouse wheel movement for current frame
+static inline void SetMouseWheelMove(int move)
+{
+    backend.mouseWheelMove = move;
+}
+
+// Set key state (down or up) for current frame
+static inline void SetKeyState(int key, bool down)
+{
+    if ((key >= 0) && (key < SOFTWARE_MAX_KEYS)) backend.keys[key] = down;
+}
+
+// Add key press (character) to current frame queue, returned by GetKeyPressed()
+static inline void PushKeyPressed(int key)
+{
+    if (backend.keyPressedCount < SOFTWARE_MAX_KEY_PRESSED_QUEUE) backend.keyPressedQueue[backend.keyPressedCount++] = key;
+}
+
+//-------------------------------------------------------------------------------
+// Input required functions
+//-------------------------------------------------------------------------------
+static Vector2 GetMousePosition(void)
+{
+    return backend.mousePosition;
+}
+
+static int GetMouseWheelMove(void)
+{
+    return backend.mouseWheelMove;
+}
+
+static bool IsMouseButtonDown(int button)
+{
+    if ((button < 0) || (button >= SOFTWARE_MAX_MOUSE_BUTTONS)) return false;
+
+    return backend.mouseButtons[button];
+}
+
+static bool IsMouseButtonPressed(int button)
+{
+    if ((button < 0) || (button >= SOFTWARE_MAX_MOUSE_BUTTONS)) return false;
+
+    return (backend.mouseButtons[button] && !backend.mouseButtonsPrevious[button]);
+}
+
+static bool IsMouseButtonReleased(int button)
+{
+    if ((button < 0) || (button >= SOFTWARE_MAX_MOUSE_BUTTONS)) return false;
+
+    return (!backend.mouseButtons[button] && backend.mouseButtonsPrevious[button]);
+}
+
+static bool IsKeyDown(int key)
+{
+    if ((key < 0) || (key >= SOFTWARE_MAX_KEYS)) return false;
+
+    return backend.keys[key];
+}
+
+static bool IsKeyPressed(int key)
+{
+    if ((key < 0) || (key >= SOFTWARE_MAX_KEYS)) return false;
+
+    return (backend.keys[key] && !backend.keysPrevious[key]);
+}
+
+// USED IN: GuiTextBox(), GuiTextBoxMulti(), GuiValueBox()
+static int GetKeyPressed(void)
+{
+    if (backend.keyPressedIndex < backend.keyPressedCount) return backend.keyPressedQueue[backend.keyPressedIndex++];
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------
+// Drawing required functions
+//-------------------------------------------------------------------------------
+static void DrawRectangle(int x, int y, int width, int height, Color color)
+{
+    backend.drawCalls++;
+
+    FillRectangle(x, y, width, height, color);
+}
+
+// USED IN: GuiColorPicker()
+// NOTE: Vertex colors order: col1 top-left, col2 bottom-left, col3 bottom-right, col4 top-right
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
+{
+    backend.drawCalls++;
+
+    if ((rec.width <= 0) || (rec.height <= 0)) return;
+
+    int x0 = (rec.x > backend.scissor.x)? rec.x : backend.scissor.x;
+    int y0 = (rec.y > backend.scissor.y)? rec.y : backend.scissor.y;
+    int x1 = ((rec.x + rec.width) < (backend.scissor.x + backend.scissor.width))? rec.x + rec.width : backend.scissor.x + backend.scissor.width;
+    int y1 = ((rec.y + rec.height) < (backend.scissor.y + backend.scissor.height))? rec.y + rec.height : backend.scissor.y + backend.scissor.height;
+
+    for (int y = y0; y < y1; y++)
+    {
+        // Interpolate left (col1->col2) and right (col4->col3) edge colors, at pixel center
+        float ty = ((float)(y - rec.y) + 0.5f)/(float)rec.height;
+        float left[4] = { col1.r + (col2.r - col1.r)*ty, col1.g + (col2.g - col1.g)*ty, col1.b + (col2.b - col1.b)*ty, col1.a + (col2.a - col1.a)*ty };
+        float right[4] = { col4.r + (col3.r - col4.r)*ty, col4.g + (col3.g - col4.g)*ty, col4.b + (col3.b - col4.b)*ty, col4.a + (col3.a - col4.a)*ty };
+
+        Color *dst = backend.pixels + y*backend.width;
+
+        for (int x = x0; x < x1; x++)
+        {
+            float tx = ((float)(x - rec.x) + 0.5f)/(float)rec.width;
+            Color color = {
+                (unsigned char)(left[0] + (right[0] - left[0])*tx + 0.5f),
+                (unsigned char)(left[1] + (right[1] - left[1])*tx + 0.5f),
+                (unsigned char)(left[2] + (right[2] - left[2])*tx + 0.5f),
+                (unsigned char)(left[3] + (right[3] - left[3])*tx + 0.5f)
+            };
+
+            BlendPixel(&dst[x], color);
+        }
+    }
+}
+
+// USED IN: GuiDropdownBox(), GuiScrollBar()
+// NOTE: Triangle is rasterized in horizontal spans (pixel centers inside triangle), any vertex order is accepted
+static void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    backend.drawCalls++;
+
+    Vector2 v[3] = { v1, v2, v3 };
+
+    float minY = v1.y, maxY = v1.y;
+    for (int i = 1; i < 3; i++)
+    {
+        minY = (v[i].y < minY)? v[i].y : minY;
+        maxY = (v[i].y > maxY)? v[i].y : maxY;
+    }
+
+    int y0 = (int)ceilf(minY - 0.5f);
+    int y1 = (int)ceilf(maxY - 0.5f);
+    if (y0 < backend.scissor.y) y0 = backend.scissor.y;
+    if (y1 > (backend.scissor.y + backend.scissor.height)) y1 = backend.scissor.y + backend.scissor.height;
+
+    for (int y = y0; y < y1; y++)
+    {
+        float centerY = (float)y + 0.5f;
+        float spanMin = 0.0f, spanMax = 0.0f;
+        bool found = false;
+
+        // Intersect pixels center row with triangle edges (half-open on y, shared edges are not filled twice)
+        for (int i = 0; i < 3; i++)
+        {
+            Vector2 a = v[i];
+            Vector2 b = v[(i + 1)%3];
+
+            if (((a.y <= centerY) && (centerY < b.y)) || ((b.y <= centerY) && (centerY < a.y)))
+            {
+                float edgeX = a.x + (centerY - a.y)*(b.x - a.x)/(b.y - a.y);
+
+                if (!found) { spanMin = edgeX; spanMax = edgeX; found = true; }
+                else
+                {
+                    spanMin = (edgeX < spanMin)? edgeX : spanMin;
+                    spanMax = (edgeX > spanMax)? edgeX : spanMax;
+                }
+            }
+        }
+
+        if (!found) continue;
+
+        int x0 = (int)ceilf(spanMin - 0.5f);
+        int x1 = (int)ceilf(spanMax - 0.5f);
+        if (x0 < backend.scissor.x) x0 = backend.scissor.x;
+        if (x1 > (backend.scissor.x + backend.scissor.width)) x1 = backend.scissor.x + backend.scissor.width;
+
+        if (x1 > x0) FillSpan(backend.pixels + y*backend.width + x0, x1 - x0, color);
+    }
+}
+
+// USED IN: GuiImageButtonEx()
+// NOTE: Negative source width/height flip the texture piece, as raylib does
+static void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint)
+{
+    backend.drawCalls++;
+
+    if ((texture.id == 0) || (texture.id > SOFTWARE_MAX_TEXTURES)) return;
+
+    const SoftwareTexture *data = &backend.textures[texture.id - 1];
+    if (data->pixels == NULL) return;
+
+    bool flipX = (sourceRec.width < 0);
+    bool flipY = (sourceRec.height < 0);
+    int width = flipX? -sourceRec.width : sourceRec.width;
+    int height = flipY? -sourceRec.height : sourceRec.height;
+
+    int posX = (int)floorf(position.x + 0.5f);
+    int posY = (int)floorf(position.y + 0.5f);
+
+    int x0 = (posX > backend.scissor.x)? posX : backend.scissor.x;
+    int y0 = (posY > backend.scissor.y)? posY : backend.scissor.y;
+    int x1 = ((posX + width) < (backend.scissor.x + backend.scissor.width))? posX + width : backend.scissor.x + backend.scissor.width;
+    int y1 = ((posY + height) < (backend.scissor.y + backend.scissor.height))? posY + height : backend.scissor.y + backend.scissor.height;
+
+    for (int y = y0; y < y1; y++)
+    {
+        int srcY = sourceRec.y + (flipY? (height - 1 - (y - posY)) : (y - posY));
+        if ((srcY < 0) || (srcY >= data->height)) continue;
+
+        Color *dst = backend.pixels + y*backend.width;
+        const Color *src = data->pixels + srcY*data->width;
+
+        for (int x = x0; x < x1; x++)
+        {
+            int srcX = sourceRec.x + (flipX? (width - 1 - (x - posX)) : (x - posX));
+            if ((srcX < 0) || (srcX >= data->width)) continue;
+
+            BlendPixel(&dst[x], ColorTint(src[srcX], tint));
+        }
+    }
+}
+
+// USED IN: GuiTextBoxMulti()
+// NOTE: Text is wrapped inside the rectangle (by words or characters) and clipped to it,
+// lines not fitting completely inside the rectangle are not drawn
+static void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint)
+{
+    (void)font;     // Embedded font used
+
+    backend.drawCalls++;
+
+    if ((text == NULL) || (fontSize <= 0.0f)) return;
+
+    float scale = fontSize/(float)SOFTWARE_FONT_BASE_SIZE;
+    float advance = (float)SOFTWARE_FONT_ADVANCE*scale + spacing;
+    float lineHeight = (float)(SOFTWARE_FONT_BASE_SIZE + SOFTWARE_FONT_BASE_SIZE/2)*scale;
+
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        if (text[i] == '\n')
+        {
+            offsetX = 0.0f;
+            offsetY += lineHeight;
+            i++;
+            continue;
+        }
+
+        int bytesProcessed = 1;
+        int glyph = GetCodepointGlyph(text + i, &bytesProcessed);
+
+        // Word wrapping: move the word to next line if it does not fit in current one
+        if (wordWrap && (text[i] != ' ') && ((i == 0) || (text[i - 1] == ' ')) && (offsetX > 0.0f))
+        {
+            int wordLength = 0;
+            for (int k = i; (text[k] != '\0') && (text[k] != ' ') && (text[k] != '\n');)
+            {
+                int wordBytes = 1;
+                GetCodepointGlyph(text + k, &wordBytes);
+                k += wordBytes;
+                wordLength++;
+            }
+
+            if ((offsetX + wordLength*advance - spacing) > rec.width)
+            {
+                offsetX = 0.0f;
+                offsetY += lineHeight;
+            }
+        }
+        else if ((offsetX + advance - spacing) > rec.width)
+        {
+            offsetX = 0.0f;
+            offsetY += lineHeight;
+
+            // Spaces are not drawn at the beginning of wrapped lines
+            if (text[i] == ' ') { i++; continue; }
+        }
+
+        if ((offsetY + fontSize) > rec.height) break;
+
+        DrawGlyph(glyph, rec.x + offsetX, rec.y + offsetY, scale, rec, tint);
+
+        offsetX += advance;
+        i += bytesProcessed;
+    }
+}
+
+//-------------------------------------------------------------------------------
+// Text required functions
+//-------------------------------------------------------------------------------
+// USED IN: GuiLoadStyleDefault()
+static inline Font GetFontDefault(void)
+{
+    Font font = { 0 };
+
+    font.baseSize = SOFTWARE_FONT_BASE_SIZE;
+    font.charsCount = SOFTWARE_FONT_CHARS_COUNT;
+
+    return font;
+}
+
+// USED IN: GetTextWidth(), GuiTextBoxMulti()
+// NOTE: Same metrics as raylib: lines advance 1.5 times the font size, spacing between characters
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    (void)font;     // Embedded font used
+
+    Vector2 size = { 0 };
+
+    if ((text == NULL) || (text[0] == '\0')) return size;
+
+    int lineLength = 0;
+    int maxLineLength = 0;
+    int lines = 1;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        if (text[i] == '\n')
+        {
+            lines++;
+            lineLength = 0;
+            i++;
+            continue;
+        }
+
+        int bytesProcessed = 1;
+        GetCodepointGlyph(text + i, &bytesProcessed);
+
+        i += bytesProcessed;
+        lineLength++;
+        if (lineLength > maxLineLength) maxLineLength = lineLength;
+    }
+
+    float scale = fontSize/(float)SOFTWARE_FONT_BASE_SIZE;
+
+    size.x = (float)(maxLineLength*SOFTWARE_FONT_ADVANCE)*scale + (float)((maxLineLength > 0)? maxLineLength - 1 : 0)*spacing;
+    size.y = ((float)SOFTWARE_FONT_BASE_SIZE + (float)(lines - 1)*SOFTWARE_FONT_BASE_SIZE*1.5f)*scale;
+
+    return size;
+}
+
+// USED IN: GuiDrawText()
+static void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    (void)font;     // Embedded font used
+
+    backend.drawCalls++;
+
+    if ((text == NULL) || (fontSize <= 0.0f)) return;
+
+    float scale = fontSize/(float)SOFTWARE_FONT_BASE_SIZE;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    for (int i = 0; text[i] != '\0';)
+    {
+        if (text[i] == '\n')
+        {
+            offsetX = 0.0f;
+            offsetY += (float)(SOFTWARE_FONT_BASE_SIZE + SOFTWARE_FONT_BASE_SIZE/2)*scale;
+            i++;
+            continue;
+        }
+
+        int bytesProcessed = 1;
+        int glyph = GetCodepointGlyph(text + i, &bytesProcessed);
+
+        DrawGlyph(glyph, position.x + offsetX, position.y + offsetY, scale, backend.scissor, tint);
+
+        offsetX += (float)SOFTWARE_FONT_ADVANCE*scale + spacing;
+        i += bytesProcessed;
+    }
+}
+
+//-------------------------------------------------------------------------------
+// GuiLoadStyle() required functions
+//-------------------------------------------------------------------------------
+// NOTE: Fonts loading not supported, GuiLoadStyle() ignores the returned font (texture id is 0)
+static Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount)
+{
+    (void)fileName;
+    (void)fontSize;
+    (void)fontChars;
+    (void)charsCount;
+
+    Font font = { 0 };
+
+    return font;
+}
+
+static char *LoadText(const char *fileName)
+{
+    char *text = NULL;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size >= 0)
+        {
+            text = (char *)malloc(size + 1);
+
+            if (text != NULL)
+            {
+                size_t count = fread(text, 1, size, file);
+                text[count] = '\0';
+            }
+        }
+
+        fclose(file);
+    }
+
+    return text;
+}
+
+static const char *GetDirectoryPath(const char *filePath)
+{
+    static char dirPath[512] = { 0 };
+    memset(dirPath, 0, 512);
+
+    const char *lastSlash = strrchr(filePath, '/');
+    const char *lastBackSlash = strrchr(filePath, '\\');
+    if ((lastBackSlash != NULL) && ((lastSlash == NULL) || (lastBackSlash > lastSlash))) lastSlash = lastBackSlash;
+
+    if (lastSlash == NULL) dirPath[0] = '.';
+    else if (lastSlash == filePath) dirPath[0] = lastSlash[0];     // Root directory
+    else
+    {
+        int length = (int)(lastSlash - filePath);
+        if (length > 511) length = 511;
+        memcpy(dirPath, filePath, length);
+    }
+
+    return dirPath;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Fill pixels span with color
+// NOTE: Opaque colors are just stored, translucent colors are blended (src-over),
+// SSE2 path processes 4 pixels per iteration using 16bit per channel arithmetic
+static void FillSpan(Color *dst, int count, Color color)
+{
+    if (color.a == 0) return;
+
+    if (color.a == 255)
+    {
+    #if defined(SOFTWARE_BACKEND_SSE2)
+        int packed = 0;
+        memcpy(&packed, &color, sizeof(int));
+        __m128i color4 = _mm_set1_epi32(packed);
+
+        for (; count >= 4; count -= 4, dst += 4) _mm_storeu_si128((__m128i *)dst, color4);
+    #endif
+        while (count-- > 0) *dst++ = color;
+    }
+    else
+    {
+    #if defined(SOFTWARE_BACKEND_SSE2)
+        // Per channel: (src*alpha + dst*(255 - alpha) + 128)/255, alpha channel uses 255 as src value
+        __m128i zero = _mm_setzero_si128();
+        __m128i src = _mm_setr_epi16(color.r*color.a, color.g*color.a, color.b*color.a, 255*color.a,
+                                     color.r*color.a, color.g*color.a, color.b*color.a, 255*color.a);
+        __m128i invAlpha = _mm_set1_epi16(255 - color.a);
+        __m128i half = _mm_set1_epi16(128);
+
+        for (; count >= 4; count -= 4, dst += 4)
+        {
+            __m128i pixels = _mm_loadu_si128((const __m128i *)dst);
+            __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+            __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+
+            lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, invAlpha), src), half);
+            hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, invAlpha), src), half);
+
+            // Exact division by 255: (x + (x >> 8)) >> 8
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+        }
+    #endif
+        while (count-- > 0) BlendPixel(dst++, color);
+    }
+}
+
+// Blend color over pixel (src-over), same results than FillSpan() SIMD path
+static void BlendPixel(Color *dst, Color color)
+{
+    if (color.a == 255) *dst = color;
+    else if (color.a > 0)
+    {
+        unsigned int invAlpha = 255 - color.a;
+        unsigned int r = dst->r*invAlpha + color.r*color.a + 128;
+        unsigned int g = dst->g*invAlpha + color.g*color.a + 128;
+        unsigned int b = dst->b*invAlpha + color.b*color.a + 128;
+        unsigned int a = dst->a*invAlpha + 255*color.a + 128;
+
+        dst->r = (unsigned char)((r + (r >> 8)) >> 8);
+        dst->g = (unsigned char)((g + (g >> 8)) >> 8);
+        dst->b = (unsigned char)((b + (b >> 8)) >> 8);
+        dst->a = (unsigned char)((a + (a >> 8)) >> 8);
+    }
+}
+
+// Fill rectangle clipped to scissor area
+static void FillRectangle(int x, int y, int width, int height, Color color)
+{
+    int x0 = (x > backend.scissor.x)? x : backend.scissor.x;
+    int y0 = (y > backend.scissor.y)? y : backend.scissor.y;
+    int x1 = ((x + width) < (backend.scissor.x + backend.scissor.width))? x + width : backend.scissor.x + backend.scissor.width;
+    int y1 = ((y + height) < (backend.scissor.y + backend.scissor.height))? y + height : backend.scissor.y + backend.scissor.height;
+
+    if ((x1 <= x0) || (y1 <= y0)) return;
+
+    for (int row = y0; row < y1; row++) FillSpan(backend.pixels + row*backend.width + x0, x1 - x0, color);
+}
+
+// Multiply color by tint
+static Color ColorTint(Color color, Color tint)
+{
+    Color result = {
+        (unsigned char)((color.r*tint.r + 127)/255),
+        (unsigned char)((color.g*tint.g + 127)/255),
+        (unsigned char)((color.b*tint.b + 127)/255),
+        (unsigned char)((color.a*tint.a + 127)/255)
+    };
+
+    return result;
+}
+
+// Get embedded font glyph index for next codepoint in text
+// NOTE: UTF-8 sequences are skipped entirely, codepoints not available in font are drawn as '?'
+static int GetCodepointGlyph(const char *text, int *bytesProcessed)
+{
+    unsigned char c = (unsigned char)text[0];
+
+    *bytesProcessed = 1;
+
+    if ((c >= SOFTWARE_FONT_FIRST_CHAR) && (c < (SOFTWARE_FONT_FIRST_CHAR + SOFTWARE_FONT_CHARS_COUNT))) return c - SOFTWARE_FONT_FIRST_CHAR;
+
+    if ((c & 0xe0) == 0xc0) *bytesProcessed = 2;
+    else if ((c & 0xf0) == 0xe0) *bytesProcessed = 3;
+    else if ((c & 0xf8) == 0xf0) *bytesProcessed = 4;
+
+    // Avoid skipping string end on malformed sequences
+    for (int i = 1; i < *bytesProcessed; i++)
+    {
+        if (((unsigned char)text[i] & 0xc0) != 0x80) { *bytesProcessed = i; break; }
+    }
+
+    return '?' - SOFTWARE_FONT_FIRST_CHAR;
+}
+
+// Draw embedded font glyph scaled (nearest), clipped to provided area and scissor
+// NOTE: Horizontal runs of glyph pixels are filled as a single span
+static void DrawGlyph(int glyph, float posX, float posY, float scale, Rectangle clip, Color tint)
+{
+    Rectangle previousScissor = backend.scissor;
+
+    // Intersect clip area with scissor
+    int x0 = (clip.x > backend.scissor.x)? clip.x : backend.scissor.x;
+    int y0 = (clip.y > backend.scissor.y)? clip.y : backend.scissor.y;
+    int x1 = ((clip.x + clip.width) < (backend.scissor.x + backend.scissor.width))? clip.x + clip.width : backend.scissor.x + backend.scissor.width;
+    int y1 = ((clip.y + clip.height) < (backend.scissor.y + backend.scissor.height))? clip.y + clip.height : backend.scissor.y + backend.scissor.height;
+
+    if ((x1 <= x0) || (y1 <= y0)) return;
+
+    backend.scissor = RAYGUI_CLITERAL(Rectangle){ x0, y0, x1 - x0, y1 - y0 };
+
+    const unsigned char *rows = softwareFontGlyphs[glyph];
+
+    for (int row = 0; row < SOFTWARE_FONT_GLYPH_ROWS; row++)
+    {
+        if (rows[row] == 0) continue;
+
+        // Glyph rows start at cell row 1
+        int top = (int)floorf(posY + (row + 1)*scale + 0.5f);
+        int bottom = (int)floorf(posY + (row + 2)*scale + 0.5f);
+
+        for (int col = 0; col < SOFTWARE_FONT_GLYPH_WIDTH;)
+        {
+            if (!(rows[row] & (0x10 >> col))) { col++; continue; }
+
+            int runStart = col;
+            while ((col < SOFTWARE_FONT_GLYPH_WIDTH) && (rows[row] & (0x10 >> col))) col++;
+
+            int left = (int)floorf(posX + runStart*scale + 0.5f);
+            int right = (int)floorf(posX + col*scale + 0.5f);
+
+            FillRectangle(left, top, right - left, bottom - top, tint);
+        }
+    }
+
+    backend.scissor = previousScissor;
+}
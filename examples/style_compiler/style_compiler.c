@@ -0,0 +1,233 @@
+/*******************************************************************************************
+*
+*   raygui - style compiler
+*
+*   Converts a raygui style file (.rgs, text or binary) into a C header with the style
+*   embedded as constant data (packed binary .rgs layout, including font atlas), to be
+*   loaded with GuiLoadStyleFromMemory() with no file access at startup:
+*
+*       #include "cyber.h"
+*       GuiLoadStyleFromMemory(cyberStyleData, sizeof(cyberStyleData));
+*
+*   Generated header also defines <NAME>_STYLE_ROWS(ROW), it can be used as raygui
+*   compiled-in default style (no font): #define RAYGUI_STYLE_DEFAULT_ROWS CYBER_STYLE_ROWS
+*
+*   If output file extension is .rgs, packed binary style file is written instead
+*
+*   USAGE:
+*       style_compiler <input.rgs> <output.h|output.rgs>
+*
+*   DEPENDENCIES:
+*       raylib 3.0  - Windowing (font atlas texture creation and readback).
+*       raygui 2.7  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 raylib technologies (@raylibtech)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static unsigned char *GenStylePacked(int *dataSize);   // Generate packed binary style data from current style and font
+static bool ExportStyleAsCode(const unsigned char *data, int dataSize, const char *fileName);   // Export style data as C header
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if ((argc < 3) || !FileExists(argv[1]))
+    {
+        printf("USAGE: style_compiler <input.rgs> <output.h|output.rgs>\n");
+        return 1;
+    }
+
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    // NOTE: Window is required to create font atlas texture and read it back, never shown
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(16, 16, "raygui - style compiler");
+
+    GuiLoadStyle(argv[1]);
+    //--------------------------------------------------------------------------------------
+
+    // Style conversion
+    //--------------------------------------------------------------------------------------
+    int dataSize = 0;
+    unsigned char *data = GenStylePacked(&dataSize);
+    bool success = false;
+
+    if (IsFileExtension(argv[2], ".rgs"))
+    {
+        FILE *rgsFile = fopen(argv[2], "wb");
+
+        if (rgsFile != NULL)
+        {
+            success = (fwrite(data, 1, dataSize, rgsFile) == (size_t)dataSize);
+            fclose(rgsFile);
+        }
+    }
+    else success = ExportStyleAsCode(data, dataSize, argv[2]);
+
+    if (success) printf("Style %s compiled to %s (%i bytes)\n", argv[1], argv[2], dataSize);
+    else printf("Style %s could not be compiled to %s\n", argv[1], argv[2]);
+
+    free(data);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();
+    //--------------------------------------------------------------------------------------
+
+    return success? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+
+// Generate packed binary style data from current style and font
+// NOTE: Layout is documented on GuiLoadStyleFromMemory(), font is only included if
+// style loaded a custom one (default font is always available)
+static unsigned char *GenStylePacked(int *dataSize)
+{
+    Font font = GuiGetFont();
+    Image imFont = { 0 };
+    int fontImageSize = 0;
+
+    if (font.texture.id > 0)
+    {
+        imFont = GetTextureData(font.texture);
+        fontImageSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+    }
+
+    int styleSize = NUM_CONTROLS*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED)*sizeof(unsigned int);
+    int fontDataSize = (font.texture.id > 0)? (4*sizeof(int) + sizeof(Rectangle) + 3*sizeof(int) + fontImageSize + font.charsCount*(sizeof(Rectangle) + 4*sizeof(int))) : 0;
+
+    *dataSize = 12 + styleSize + sizeof(int) + fontDataSize;
+    unsigned char *data = (unsigned char *)calloc(*dataSize, 1);
+    unsigned char *ptr = data;
+
+    // Header: signature, version, reserved, controls count, properties per control
+    short header[4] = { 100, 0, NUM_CONTROLS, NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED };
+    memcpy(ptr, "rGSP", 4); ptr += 4;
+    memcpy(ptr, header, sizeof(header)); ptr += sizeof(header);
+
+    // Properties data: full style table
+    for (int i = 0; i < NUM_CONTROLS; i++)
+    {
+        for (int j = 0; j < (NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED); j++)
+        {
+            unsigned int value = (unsigned int)GuiGetStyle(i, j);
+            memcpy(ptr, &value, sizeof(unsigned int)); ptr += sizeof(unsigned int);
+        }
+    }
+
+    // Font data
+    memcpy(ptr, &fontDataSize, sizeof(int)); ptr += sizeof(int);
+
+    if (fontDataSize > 0)
+    {
+        int fontType = 0;               // 0-Normal, 1-SDF
+        Rectangle whiteRec = { 0 };     // Not defined for style fonts
+
+        memcpy(ptr, &font.baseSize, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, &font.charsCount, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, &fontType, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, &whiteRec, sizeof(Rectangle)); ptr += sizeof(Rectangle);
+        memcpy(ptr, &fontImageSize, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, &imFont.width, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, &imFont.height, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, &imFont.format, sizeof(int)); ptr += sizeof(int);
+        memcpy(ptr, imFont.data, fontImageSize); ptr += fontImageSize;
+
+        memcpy(ptr, font.recs, font.charsCount*sizeof(Rectangle)); ptr += font.charsCount*sizeof(Rectangle);
+        for (int i = 0; i < font.charsCount; i++)
+        {
+            memcpy(ptr, &font.chars[i].value, 4*sizeof(int)); ptr += 4*sizeof(int);
+        }
+
+        UnloadImage(imFont);
+    }
+
+    return data;
+}
+
+// Export style data as C header
+// NOTE: Data array and rows macro are named after output file name
+static bool ExportStyleAsCode(const unsigned char *data, int dataSize, const char *fileName)
+{
+    FILE *codeFile = fopen(fileName, "wt");
+
+    if (codeFile == NULL) return false;
+
+    // Get style name from file name, valid as C identifier
+    char name[64] = { 0 };
+    char nameUpper[64] = { 0 };
+    strncpy(name, GetFileNameWithoutExt(fileName), 63);
+
+    for (int i = 0; name[i] != '\0'; i++)
+    {
+        if (!isalnum((unsigned char)name[i])) name[i] = '_';
+        nameUpper[i] = (char)toupper((unsigned char)name[i]);
+    }
+
+    fprintf(codeFile, "// raygui style: %s, compiled with style_compiler (do not edit)\n", name);
+    fprintf(codeFile, "// USAGE: GuiLoadStyleFromMemory(%sStyleData, sizeof(%sStyleData));\n\n", name, name);
+
+    fprintf(codeFile, "#ifndef %s_STYLE_H\n#define %s_STYLE_H\n\n", nameUpper, nameUpper);
+
+    // Style rows, same format as RAYGUI_STYLE_DEFAULT_ROWS(ROW)
+    fprintf(codeFile, "// Style properties, one ROW(...) per control, can be used as RAYGUI_STYLE_DEFAULT_ROWS\n");
+    fprintf(codeFile, "#define %s_STYLE_ROWS(ROW) \\\n", nameUpper);
+
+    for (int i = 0; i < NUM_CONTROLS; i++)
+    {
+        fprintf(codeFile, "    ROW(");
+
+        for (int j = 0; j < (NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED); j++)
+        {
+            unsigned int value = (unsigned int)GuiGetStyle(i, j);
+
+            if (value > 0xffff) fprintf(codeFile, "0x%08x", value);
+            else fprintf(codeFile, "%u", value);
+
+            if (j < (NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED - 1)) fprintf(codeFile, ", ");
+        }
+
+        fprintf(codeFile, ")%s\n", (i < (NUM_CONTROLS - 1))? " \\" : "");
+    }
+
+    // Style data, packed binary .rgs file data
+    fprintf(codeFile, "\n// Style data: packed binary style file (.rgs), font included\n");
+    fprintf(codeFile, "static const unsigned char %sStyleData[%i] = {", name, dataSize);
+
+    for (int i = 0; i < dataSize; i++)
+    {
+        if ((i%20) == 0) fprintf(codeFile, "\n    ");
+        fprintf(codeFile, "0x%02x%s", data[i], (i < (dataSize - 1))? ", " : "");
+    }
+
+    fprintf(codeFile, " };\n\n#endif // %s_STYLE_H\n", nameUpper);
+
+    fclose(codeFile);
+
+    return true;
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************************
+*
+*   raygui - style hot reload
+*
+*   Style file is loaded and watched: edit and save it (i.e. with rGuiStyler or a text editor)
+*   while the program runs, changed style properties are applied on next frame.
+*
+*   DEPENDENCIES:
+*       raylib 3.0          - Windowing/input management and drawing.
+*       raygui 2.7          - Immediate-mode GUI controls.
+*       gui_hot_reload.h    - Style and icons files hot reload (POSIX threads)
+*
+*   COMPILATION (Linux - GCC):
+*       gcc -o $(NAME_PART) $(FILE_NAME) -I../../src -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -std=c99
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+
+#define GUI_HOT_RELOAD_IMPLEMENTATION
+#include "../../src/gui_hot_reload.h"
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 600;
+    const int screenHeight = 400;
+
+    InitWindow(screenWidth, screenHeight, "raygui - style hot reload");
+
+    // Style file could be provided as argument
+    const char *styleFileName = (argc > 1)? argv[1] : "../../styles/cyber/cyber.rgs";
+
+    // NOTE: Style is loaded first, watcher takes file contents as reference for later changes
+    GuiLoadStyle(styleFileName);
+    bool watching = GuiStartHotReload(styleFileName, NULL);
+
+    bool checked = false;
+    float value = 50.0f;
+    int active = 0;
+
+    SetTargetFPS(60);
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        GuiUpdateHotReload();       // Apply style changes saved since last frame (never waits)
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            GuiGroupBox((Rectangle){ 20, 20, 560, 360 }, "HOT RELOAD");
+
+            GuiLabel((Rectangle){ 40, 40, 520, 20 }, watching? TextFormat("Watching: %s", GetFileName(styleFileName)) : "Hot reload not available");
+
+            if (GuiButton((Rectangle){ 40, 80, 160, 30 }, "Reload style")) GuiLoadStyle(styleFileName);
+            checked = GuiCheckBox((Rectangle){ 40, 130, 20, 20 }, "Check box", checked);
+            value = GuiSliderBar((Rectangle){ 100, 170, 300, 20 }, "Slider", TextFormat("%.0f", value), value, 0, 100);
+            active = GuiToggleGroup((Rectangle){ 40, 210, 120, 30 }, "ONE;TWO;THREE;FOUR", active);
+            GuiProgressBar((Rectangle){ 40, 260, 360, 20 }, NULL, NULL, value, 0, 100);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    GuiStopHotReload();     // Stop watcher thread
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -275,7 +275,6 @@ int main(int argc, char **argv)
             textboxBounds[textboxActive].y = 85 - height;
             textboxBounds[textboxActive].height = height;
             textboxBounds[textboxActive].width = width;
-            if (changed) GuiTextBoxSetActive(textboxBounds[textboxActive]);
             
             // UI for selecting the selected text background and foreground color
             if (ColorButton((Rectangle){625,320,30,30}, colorFG)) colorSelected = &colorFG;
@@ -0,0 +1,559 @@
+/*******************************************************************************************
+*
+*   Hot reload of style (.rgs) and icons (.rgi) files
+*
+*   MODULE USAGE:
+*       #define GUI_HOT_RELOAD_IMPLEMENTATION
+*       #include "gui_hot_reload.h"
+*
+*       NOTE: Implementation must be included in the same translation unit as raygui implementation
+*
+*   On initialization:  GuiStartHotReload("styles/my_style.rgs", "icons/my_icons.rgi");   (any could be NULL)
+*   Between frames:     GuiUpdateHotReload();
+*   On de-initialization: GuiStopHotReload();
+*
+*   Files are watched on a background thread (inotify on Linux, file modification time polling
+*   otherwise), changed files are loaded and parsed on that thread and compared with previous load,
+*   only style properties and icons that changed in the file are applied by GuiUpdateHotReload().
+*   GuiUpdateHotReload() never waits for the watcher thread: if it is publishing changes,
+*   they are applied on next call. Style properties changed at runtime by the program are kept
+*   unless they also change in the file. Style font is not reloaded (requires graphics context).
+*
+*   Initial file contents are taken as reference (style and icons expected to be already loaded).
+*
+*   CONFIGURATION:
+*
+*   #define GUI_HOT_RELOAD_POLL_TIME
+*       Milliseconds between file checks when polling, also maximum time to stop the watcher
+*
+*   DEPENDENCIES:
+*       POSIX threads, not available on Windows (GuiStartHotReload() returns false)
+*       Thread-local gui context (RAYGUI_THREAD_LOCAL), watcher thread uses its own context
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef GUI_HOT_RELOAD_H
+#define GUI_HOT_RELOAD_H
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+RAYGUIDEF bool GuiStartHotReload(const char *styleFileName, const char *iconsFileName);    // Start watching style and icons files (any could be NULL)
+RAYGUIDEF void GuiUpdateHotReload(void);                                // Apply style and icons changes loaded since last call (never blocks)
+RAYGUIDEF void GuiStopHotReload(void);                                  // Stop watching files
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_HOT_RELOAD_H
+
+/***********************************************************************************
+*
+*   GUI HOT RELOAD IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(GUI_HOT_RELOAD_IMPLEMENTATION)
+
+#include "raygui.h"
+
+#if !defined(_WIN32)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_mutex_*()
+    #include <sys/stat.h>       // Required for: stat()
+    #include <time.h>           // Required for: nanosleep()
+    #include <unistd.h>         // Required for: read(), close()
+#if defined(__linux__)
+    #include <sys/inotify.h>    // Required for: inotify_init1(), inotify_add_watch()
+    #include <poll.h>           // Required for: poll()
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if !defined(GUI_HOT_RELOAD_POLL_TIME)
+    #define GUI_HOT_RELOAD_POLL_TIME     250    // Milliseconds between file checks
+#endif
+
+#define GUI_HOT_RELOAD_MAX_PATH          512    // Maximum watched file path length
+#define GUI_HOT_RELOAD_STYLE_SIZE       (NUM_CONTROLS*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED))
+
+#if !defined(_WIN32)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Watched file
+typedef struct GuiHotReloadFile {
+    char fileName[GUI_HOT_RELOAD_MAX_PATH];     // File path (empty if not watched)
+    const char *name;               // File name inside its directory (points into fileName)
+    int watch;                      // File directory inotify watch descriptor (-1 if not watched)
+    long long modTime;              // File modification time in nanoseconds, used when polling
+    long long size;                 // File size, used when polling
+    bool loaded;                    // File has been loaded at least once (reference available)
+} GuiHotReloadFile;
+
+// Hot reload state
+// NOTE: Loaded data is only accessed by watcher thread, pending data is protected by mutex
+typedef struct GuiHotReload {
+    pthread_t thread;               // Watcher thread
+    pthread_mutex_t mutex;          // Protects running flag and pending data
+    bool running;                   // Watcher thread must keep running
+
+    GuiHotReloadFile style;         // Style file watched
+    GuiHotReloadFile icons;         // Icons file watched
+
+    unsigned int styleLoaded[GUI_HOT_RELOAD_STYLE_SIZE];        // Style properties from last load
+    unsigned int stylePending[GUI_HOT_RELOAD_STYLE_SIZE];       // Style properties to be applied
+    bool styleChanged[GUI_HOT_RELOAD_STYLE_SIZE];               // Style properties pending to be applied
+#if defined(RAYGUI_SUPPORT_ICONS)
+    unsigned int iconsLoaded[RICON_MAX_ICONS*RICON_DATA_ELEMENTS];      // Icons data from last load
+    unsigned int iconsPending[RICON_MAX_ICONS*RICON_DATA_ELEMENTS];     // Icons data to be applied
+    bool iconsChanged[RICON_MAX_ICONS];                                 // Icons pending to be applied
+#endif
+    bool pending;                   // Some change is pending to be applied
+} GuiHotReload;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static GuiHotReload *guiHotReload = NULL;       // Hot reload state, created by GuiStartHotReload()
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void *GuiHotReloadThread(void *arg);                             // Watcher thread entry point
+static void GuiInitHotReloadFile(GuiHotReloadFile *file, const char *fileName);    // Init watched file
+static bool GuiCheckHotReloadFile(GuiHotReloadFile *file);              // Check file modification (polling)
+static unsigned char *GuiLoadHotReloadData(const char *fileName, int *dataSize);   // Load file data (NULL-terminated)
+static void GuiReloadStyle(GuiHotReload *hotReload);                    // Load style file and publish changed properties
+#if defined(RAYGUI_SUPPORT_ICONS)
+static void GuiReloadIcons(GuiHotReload *hotReload);                    // Load icons file and publish changed icons
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Start watching style and icons files (any could be NULL)
+// NOTE: Watcher thread loads files initial contents as reference for later changes
+bool GuiStartHotReload(const char *styleFileName, const char *iconsFileName)
+{
+    if ((guiHotReload != NULL) || ((styleFileName == NULL) && (iconsFileName == NULL))) return false;
+
+    GuiHotReload *hotReload = (GuiHotReload *)RAYGUI_CALLOC(1, sizeof(GuiHotReload));
+
+    if (hotReload == NULL) return false;
+
+    GuiInitHotReloadFile(&hotReload->style, styleFileName);
+#if defined(RAYGUI_SUPPORT_ICONS)
+    GuiInitHotReloadFile(&hotReload->icons, iconsFileName);
+#else
+    GuiInitHotReloadFile(&hotReload->icons, NULL);
+#endif
+
+    hotReload->running = true;
+
+    if (pthread_mutex_init(&hotReload->mutex, NULL) != 0)
+    {
+        RAYGUI_FREE(hotReload);
+        return false;
+    }
+
+    if (pthread_create(&hotReload->thread, NULL, GuiHotReloadThread, hotReload) != 0)
+    {
+        pthread_mutex_destroy(&hotReload->mutex);
+        RAYGUI_FREE(hotReload);
+        return false;
+    }
+
+    guiHotReload = hotReload;
+
+    return true;
+}
+
+// Apply style and icons changes loaded since last call
+// NOTE: Changes are applied over current context style, it never waits for watcher thread
+void GuiUpdateHotReload(void)
+{
+    GuiHotReload *hotReload = guiHotReload;
+
+    if (hotReload == NULL) return;
+    if (pthread_mutex_trylock(&hotReload->mutex) != 0) return;     // Watcher thread is publishing changes
+
+    if (hotReload->pending)
+    {
+        bool textChanged = false;
+
+        for (int i = 0; i < GUI_HOT_RELOAD_STYLE_SIZE; i++)
+        {
+            if (!hotReload->styleChanged[i]) continue;
+
+            int control = i/(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED);
+            int property = i%(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED);
+
+            guiStyle[i] = hotReload->stylePending[i];
+
+            if (property < NUM_PROPS_COLORS) guiStyleColors[control*NUM_PROPS_COLORS + property] = Fade(GetColor(guiStyle[i]), guiAlpha);
+            else if ((control == 0) && ((property == TEXT_SIZE) || (property == TEXT_SPACING))) textChanged = true;
+
+            hotReload->styleChanged[i] = false;
+        }
+
+        if (textChanged) GuiInvalidateTextMeasure();
+
+#if defined(RAYGUI_SUPPORT_ICONS)
+        for (int i = 0; i < RICON_MAX_ICONS; i++)
+        {
+            if (!hotReload->iconsChanged[i]) continue;
+
+            GuiSetIconData(i, &hotReload->iconsPending[i*RICON_DATA_ELEMENTS]);
+            hotReload->iconsChanged[i] = false;
+        }
+#endif
+        hotReload->pending = false;
+    }
+
+    pthread_mutex_unlock(&hotReload->mutex);
+}
+
+// Stop watching files
+// NOTE: It waits for watcher thread to finish, up to GUI_HOT_RELOAD_POLL_TIME
+void GuiStopHotReload(void)
+{
+    GuiHotReload *hotReload = guiHotReload;
+
+    if (hotReload == NULL) return;
+
+    pthread_mutex_lock(&hotReload->mutex);
+    hotReload->running = false;
+    pthread_mutex_unlock(&hotReload->mutex);
+
+    pthread_join(hotReload->thread, NULL);
+    pthread_mutex_destroy(&hotReload->mutex);
+
+    RAYGUI_FREE(hotReload);
+    guiHotReload = NULL;
+}
+
+// Watcher thread entry point
+// NOTE: Styles are loaded over a gui context owned by this thread
+static void *GuiHotReloadThread(void *arg)
+{
+    GuiHotReload *hotReload = (GuiHotReload *)arg;
+    GuiContext *ctx = GuiCreateContext();
+
+    if (ctx == NULL) return NULL;
+
+    GuiSetContext(ctx);
+
+    // Load reference contents
+    if (hotReload->style.fileName[0] != '\0') GuiReloadStyle(hotReload);
+#if defined(RAYGUI_SUPPORT_ICONS)
+    if (hotReload->icons.fileName[0] != '\0') GuiReloadIcons(hotReload);
+#endif
+
+    int notify = -1;
+
+#if defined(__linux__)
+    // Files directories are watched, editors usually save files by renaming a new one
+    notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (notify >= 0)
+    {
+        GuiHotReloadFile *files[2] = { &hotReload->style, &hotReload->icons };
+
+        for (int i = 0; i < 2; i++)
+        {
+            if (files[i]->fileName[0] == '\0') continue;
+
+            char directory[GUI_HOT_RELOAD_MAX_PATH] = { 0 };
+            int length = (int)(files[i]->name - files[i]->fileName);
+
+            if (length == 0) strcpy(directory, ".");
+            else memcpy(directory, files[i]->fileName, (length > 1)? length - 1 : 1);
+
+            files[i]->watch = inotify_add_watch(notify, directory, IN_CLOSE_WRITE | IN_MOVED_TO);
+
+            // Fallback to polling if some directory can not be watched
+            if (files[i]->watch < 0)
+            {
+                close(notify);
+                notify = -1;
+                break;
+            }
+        }
+    }
+#endif
+
+    while (true)
+    {
+        pthread_mutex_lock(&hotReload->mutex);
+        bool running = hotReload->running;
+        pthread_mutex_unlock(&hotReload->mutex);
+
+        if (!running) break;
+
+        bool styleModified = false;
+        bool iconsModified = false;
+
+#if defined(__linux__)
+        if (notify >= 0)
+        {
+            struct pollfd pollFd = { notify, POLLIN, 0 };
+
+            if (poll(&pollFd, 1, GUI_HOT_RELOAD_POLL_TIME) > 0)
+            {
+                union { struct inotify_event event; char data[4096]; } buffer;
+                int bytes = 0;
+
+                while ((bytes = (int)read(notify, buffer.data, sizeof(buffer))) > 0)
+                {
+                    for (int offset = 0; offset < bytes; )
+                    {
+                        const struct inotify_event *event = (const struct inotify_event *)(buffer.data + offset);
+
+                        if (event->len > 0)
+                        {
+                            if ((event->wd == hotReload->style.watch) && (strcmp(event->name, hotReload->style.name) == 0)) styleModified = true;
+                            if ((event->wd == hotReload->icons.watch) && (strcmp(event->name, hotReload->icons.name) == 0)) iconsModified = true;
+                        }
+
+                        offset += (int)sizeof(struct inotify_event) + event->len;
+                    }
+                }
+            }
+        }
+        else
+#endif
+        {
+            struct timespec wait = { GUI_HOT_RELOAD_POLL_TIME/1000, (GUI_HOT_RELOAD_POLL_TIME%1000)*1000000L };
+            nanosleep(&wait, NULL);
+
+            styleModified = GuiCheckHotReloadFile(&hotReload->style);
+            iconsModified = GuiCheckHotReloadFile(&hotReload->icons);
+        }
+
+        if (styleModified) GuiReloadStyle(hotReload);
+#if defined(RAYGUI_SUPPORT_ICONS)
+        if (iconsModified) GuiReloadIcons(hotReload);
+#else
+        (void)iconsModified;    // Icons file is not watched
+#endif
+    }
+
+    if (notify >= 0) close(notify);
+
+    GuiSetContext(NULL);
+    GuiDestroyContext(ctx);
+
+    return NULL;
+}
+
+// Init watched file
+static void GuiInitHotReloadFile(GuiHotReloadFile *file, const char *fileName)
+{
+    file->watch = -1;
+
+    if ((fileName == NULL) || (strlen(fileName) >= GUI_HOT_RELOAD_MAX_PATH)) return;
+
+    strcpy(file->fileName, fileName);
+
+    const char *separator = strrchr(file->fileName, '/');
+    file->name = (separator != NULL)? separator + 1 : file->fileName;
+
+    GuiCheckHotReloadFile(file);
+}
+
+// Check file modification (polling), returns true if modification time or size changed
+static bool GuiCheckHotReloadFile(GuiHotReloadFile *file)
+{
+    struct stat info = { 0 };
+
+    if ((file->fileName[0] == '\0') || (stat(file->fileName, &info) != 0)) return false;
+
+#if defined(__APPLE__)
+    long long modTime = (long long)info.st_mtimespec.tv_sec*1000000000LL + info.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    long long modTime = (long long)info.st_mtim.tv_sec*1000000000LL + info.st_mtim.tv_nsec;
+#else
+    long long modTime = (long long)info.st_mtime*1000000000LL;
+#endif
+    bool modified = (file->modTime != modTime) || (file->size != (long long)info.st_size);
+
+    file->modTime = modTime;
+    file->size = (long long)info.st_size;
+
+    return modified;
+}
+
+// Load file data, NULL-terminated (text files)
+static unsigned char *GuiLoadHotReloadData(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    FILE *file = fopen(fileName, "rb");
+
+    *dataSize = 0;
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if ((size > 0) && (size < INT_MAX)) data = (unsigned char *)RAYGUI_MALLOC(size + 1);
+
+        if (data != NULL)
+        {
+            if (fread(data, 1, size, file) == (size_t)size)
+            {
+                data[size] = '\0';
+                *dataSize = (int)size;
+            }
+            else
+            {
+                RAYGUI_FREE(data);
+                data = NULL;
+            }
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+// Load style file and publish changed properties
+// NOTE: Style is loaded over default style on watcher thread context, font is not loaded
+static void GuiReloadStyle(GuiHotReload *hotReload)
+{
+    int dataSize = 0;
+    unsigned char *data = GuiLoadHotReloadData(hotReload->style.fileName, &dataSize);
+
+    if (data == NULL) return;
+
+    GuiLoadStyleDefault();
+
+    bool valid = true;
+    if (data[0] == '#') GuiLoadStyleText((const char *)data, NULL);
+    else valid = (GuiLoadStyleProperties(data, dataSize) > 0);
+
+    RAYGUI_FREE(data);
+
+    if (!valid) return;
+
+    if (hotReload->style.loaded)
+    {
+        pthread_mutex_lock(&hotReload->mutex);
+
+        for (int i = 0; i < GUI_HOT_RELOAD_STYLE_SIZE; i++)
+        {
+            if (guiStyle[i] != hotReload->styleLoaded[i])
+            {
+                hotReload->stylePending[i] = guiStyle[i];
+                hotReload->styleChanged[i] = true;
+                hotReload->pending = true;
+            }
+        }
+
+        pthread_mutex_unlock(&hotReload->mutex);
+    }
+
+    memcpy(hotReload->styleLoaded, guiStyle, sizeof(hotReload->styleLoaded));
+    hotReload->style.loaded = true;
+}
+
+#if defined(RAYGUI_SUPPORT_ICONS)
+// Load icons file and publish changed icons
+// NOTE: Only icons with same size as RICON_SIZE are loaded (check GuiLoadIcons() for file structure)
+static void GuiReloadIcons(GuiHotReload *hotReload)
+{
+    int dataSize = 0;
+    unsigned char *data = GuiLoadHotReloadData(hotReload->icons.fileName, &dataSize);
+
+    if (data == NULL) return;
+
+    short iconsCount = 0;
+    short iconsSize = 0;
+
+    if (dataSize >= 12)
+    {
+        memcpy(&iconsCount, data + 8, sizeof(short));
+        memcpy(&iconsSize, data + 10, sizeof(short));
+    }
+
+    bool valid = (dataSize >= 12) && (memcmp(data, "rGI ", 4) == 0) &&
+                 (iconsSize == RICON_SIZE) && (iconsCount > 0) && (iconsCount <= RICON_MAX_ICONS) &&
+                 ((12 + iconsCount*(32 + RICON_DATA_ELEMENTS*(int)sizeof(unsigned int))) <= dataSize);
+
+    if (valid)
+    {
+        const unsigned char *iconsData = data + 12 + iconsCount*32;     // Skip icons name ids
+
+        if (hotReload->icons.loaded)
+        {
+            pthread_mutex_lock(&hotReload->mutex);
+
+            for (int i = 0; i < iconsCount; i++)
+            {
+                const unsigned char *iconData = iconsData + i*RICON_DATA_ELEMENTS*sizeof(unsigned int);
+
+                if (memcmp(iconData, &hotReload->iconsLoaded[i*RICON_DATA_ELEMENTS], RICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
+                {
+                    memcpy(&hotReload->iconsPending[i*RICON_DATA_ELEMENTS], iconData, RICON_DATA_ELEMENTS*sizeof(unsigned int));
+                    hotReload->iconsChanged[i] = true;
+                    hotReload->pending = true;
+                }
+            }
+
+            pthread_mutex_unlock(&hotReload->mutex);
+        }
+
+        memcpy(hotReload->iconsLoaded, iconsData, iconsCount*RICON_DATA_ELEMENTS*sizeof(unsigned int));
+        hotReload->icons.loaded = true;
+    }
+
+    RAYGUI_FREE(data);
+}
+#endif
+
+#else   // _WIN32
+
+// Hot reload not available, it requires POSIX threads
+bool GuiStartHotReload(const char *styleFileName, const char *iconsFileName)
+{
+    (void)styleFileName;
+    (void)iconsFileName;
+
+    return false;
+}
+void GuiUpdateHotReload(void) { }
+void GuiStopHotReload(void) { }
+
+#endif  // !_WIN32
+
+#endif  // GUI_HOT_RELOAD_IMPLEMENTATION
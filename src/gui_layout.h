@@ -0,0 +1,474 @@
+/*******************************************************************************************
+*
+*   Layout of controls bounds (rows, columns and grids)
+*
+*   MODULE USAGE:
+*       #define GUI_LAYOUT_IMPLEMENTATION
+*       #include "gui_layout.h"
+*
+*       NOTE: Implementation must be included in the same translation unit as raygui implementation
+*
+*   On game draw call:
+*       GuiLayoutItem items[3] = { GuiLayoutText("Width:"), GuiLayoutFlex(1), GuiLayoutFixed(30) };
+*       Rectangle cells[3] = { 0 };
+*       GuiLayoutRow(GuiGetId("width"), bounds, items, 3, cells);
+*
+*   Items are measured first (fixed sizes, text sizes with current font and style) and remaining
+*   space is shared by flex items by their weight, cells are arranged inside bounds with
+*   DEFAULT LAYOUT_PADDING (around cells) and LAYOUT_SPACING (between cells) style properties.
+*   Nested layouts just use a cell as bounds (i.e. a row on every cell of a column).
+*
+*   Computed cells are cached by layout id (check GuiGetId()/GuiGetIdPtr()): layout is only
+*   measured and arranged again when its inputs change (bounds, items, text content, font or
+*   style), otherwise cells are copied from cache.
+*
+*   CONFIGURATION:
+*
+*   #define GUI_LAYOUT_CACHE_SIZE
+*       Initial layouts cache capacity (must be power of 2), cache grows as required
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2020 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef GUI_LAYOUT_H
+#define GUI_LAYOUT_H
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Layout item size mode
+typedef enum {
+    GUI_LAYOUT_FIXED = 0,           // Fixed size in pixels
+    GUI_LAYOUT_FLEX,                // Share of remaining space, by weight
+    GUI_LAYOUT_TEXT                 // Text size (current font and style), plus style TEXT_PADDING
+} GuiLayoutSizeMode;
+
+// Layout item, measured along layout direction
+typedef struct GuiLayoutItem {
+    int mode;                       // Item size mode (GuiLayoutSizeMode)
+    float value;                    // Item size (GUI_LAYOUT_FIXED) or weight (GUI_LAYOUT_FLEX)
+    const char *text;               // Item text (GUI_LAYOUT_TEXT)
+} GuiLayoutItem;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+RAYGUIDEF GuiLayoutItem GuiLayoutFixed(float size);                     // Get layout item with fixed size
+RAYGUIDEF GuiLayoutItem GuiLayoutFlex(float weight);                    // Get layout item sharing remaining space by weight
+RAYGUIDEF GuiLayoutItem GuiLayoutText(const char *text);                // Get layout item fitting text
+
+RAYGUIDEF void GuiLayoutRow(unsigned int id, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells);       // Arrange items horizontally, cells get full bounds height
+RAYGUIDEF void GuiLayoutColumn(unsigned int id, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells);    // Arrange items vertically, cells get full bounds width
+RAYGUIDEF void GuiLayoutGrid(unsigned int id, Rectangle bounds, const GuiLayoutItem *columns, int columnsCount, const GuiLayoutItem *rows, int rowsCount, Rectangle *cells);  // Arrange grid cells (row by row)
+
+RAYGUIDEF void GuiGetLayoutStats(int *hits, int *misses);               // Get layouts cache hits (cells copied) and misses (cells computed)
+RAYGUIDEF void GuiUnloadLayoutCache(void);                              // Unload layouts cache (calling thread)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_LAYOUT_H
+
+/***********************************************************************************
+*
+*   GUI LAYOUT IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(GUI_LAYOUT_IMPLEMENTATION)
+
+#include "raygui.h"
+
+#include <math.h>               // Required for: floorf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if !defined(GUI_LAYOUT_CACHE_SIZE)
+    #define GUI_LAYOUT_CACHE_SIZE       256     // Initial layouts cache capacity (must be power of 2)
+#endif
+
+#define GUI_LAYOUT_MEASURE_BATCH        64      // Items measured on stack, larger layouts allocate temporary memory
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Layout direction, required to measure items
+typedef enum {
+    GUI_LAYOUT_ROW = 0,             // Items arranged horizontally
+    GUI_LAYOUT_COLUMN               // Items arranged vertically
+} GuiLayoutDirection;
+
+// Cached layout
+typedef struct GuiLayoutEntry {
+    unsigned int id;                // Layout id (0 for empty entries)
+    unsigned int signature;         // Layout inputs hash (bounds, items, text, font, style)
+    Rectangle *cells;               // Layout cells computed
+    int cellsCount;                 // Layout cells count
+    int cellsCapacity;              // Layout cells array capacity
+} GuiLayoutEntry;
+
+// Layouts cache
+// NOTE: Open-addressed (linear probing) table by layout id, its capacity is a power of 2
+typedef struct GuiLayoutCache {
+    GuiLayoutEntry *entries;        // Cached layouts
+    int count;                      // Cached layouts count
+    int capacity;                   // Cached layouts capacity (grows as required)
+    int hits;                       // Layouts copied from cache
+    int misses;                     // Layouts measured and arranged
+} GuiLayoutCache;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static RAYGUI_THREAD_LOCAL GuiLayoutCache guiLayoutCache = { 0 };   // Layouts cache (per thread, like current context)
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GuiHashLayout(unsigned int hash, const void *data, int size);  // Add data to layout signature (FNV-1a)
+static unsigned int GuiLayoutSignature(int direction, Rectangle bounds, const GuiLayoutItem *items, int count, unsigned int hash);  // Compute items signature
+static GuiLayoutEntry *GuiGetLayoutEntry(unsigned int id);              // Get cached layout entry, inserted if not found (NULL on allocation failure)
+static bool GuiReserveLayoutCells(GuiLayoutEntry *entry, int count);    // Make sure cached layout has capacity for `count` cells
+static void GuiMeasureLayout(int direction, const GuiLayoutItem *items, int count, float length, float *sizes);  // Measure items sizes along direction
+static void GuiArrangeLayout(int direction, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells);  // Measure and arrange items inside bounds
+static void GuiLayoutLine(int direction, unsigned int id, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells);  // Arrange row or column, cached
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get layout item with fixed size
+GuiLayoutItem GuiLayoutFixed(float size)
+{
+    GuiLayoutItem item = { GUI_LAYOUT_FIXED, size, NULL };
+    return item;
+}
+
+// Get layout item sharing remaining space by weight
+GuiLayoutItem GuiLayoutFlex(float weight)
+{
+    GuiLayoutItem item = { GUI_LAYOUT_FLEX, weight, NULL };
+    return item;
+}
+
+// Get layout item fitting text
+// NOTE: Text is measured when layout is computed, text content is part of layout signature
+GuiLayoutItem GuiLayoutText(const char *text)
+{
+    GuiLayoutItem item = { GUI_LAYOUT_TEXT, 0.0f, text };
+    return item;
+}
+
+// Arrange items horizontally inside bounds
+void GuiLayoutRow(unsigned int id, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells)
+{
+    GuiLayoutLine(GUI_LAYOUT_ROW, id, bounds, items, count, cells);
+}
+
+// Arrange items vertically inside bounds
+void GuiLayoutColumn(unsigned int id, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells)
+{
+    GuiLayoutLine(GUI_LAYOUT_COLUMN, id, bounds, items, count, cells);
+}
+
+// Arrange grid cells inside bounds, cells are stored row by row (rowsCount*columnsCount cells)
+// NOTE: Columns are measured along bounds width and rows along bounds height, spacing is used between both
+void GuiLayoutGrid(unsigned int id, Rectangle bounds, const GuiLayoutItem *columns, int columnsCount, const GuiLayoutItem *rows, int rowsCount, Rectangle *cells)
+{
+    if ((columnsCount <= 0) || (rowsCount <= 0)) return;
+
+    int count = columnsCount*rowsCount;
+    unsigned int signature = GuiLayoutSignature(GUI_LAYOUT_ROW, bounds, columns, columnsCount, 2166136261u);
+    signature = GuiLayoutSignature(GUI_LAYOUT_COLUMN, bounds, rows, rowsCount, signature);
+
+    GuiLayoutEntry *entry = GuiGetLayoutEntry(id);
+
+    if ((entry != NULL) && (entry->signature == signature) && (entry->cellsCount == count))
+    {
+        memcpy(cells, entry->cells, count*sizeof(Rectangle));
+        guiLayoutCache.hits++;
+        return;
+    }
+
+    // Arrange columns on first row and rows separately, grid cells combine them
+    Rectangle batch[GUI_LAYOUT_MEASURE_BATCH];
+    Rectangle *rowCells = batch;
+    if (rowsCount > GUI_LAYOUT_MEASURE_BATCH) rowCells = (Rectangle *)RAYGUI_MALLOC(rowsCount*sizeof(Rectangle));
+    if (rowCells == NULL) { memset(cells, 0, count*sizeof(Rectangle)); return; }
+
+    GuiArrangeLayout(GUI_LAYOUT_ROW, bounds, columns, columnsCount, cells);
+    GuiArrangeLayout(GUI_LAYOUT_COLUMN, bounds, rows, rowsCount, rowCells);
+
+    // NOTE: First row is written last, its cells hold columns bounds until then
+    for (int r = rowsCount - 1; r >= 0; r--)
+    {
+        for (int c = 0; c < columnsCount; c++)
+        {
+            Rectangle cell = { cells[c].x, rowCells[r].y, cells[c].width, rowCells[r].height };
+            cells[r*columnsCount + c] = cell;
+        }
+    }
+
+    if (rowCells != batch) RAYGUI_FREE(rowCells);
+
+    guiLayoutCache.misses++;
+
+    if ((entry != NULL) && GuiReserveLayoutCells(entry, count))
+    {
+        memcpy(entry->cells, cells, count*sizeof(Rectangle));
+        entry->cellsCount = count;
+        entry->signature = signature;
+    }
+}
+
+// Get layouts cache hits (cells copied) and misses (cells computed)
+void GuiGetLayoutStats(int *hits, int *misses)
+{
+    if (hits != NULL) *hits = guiLayoutCache.hits;
+    if (misses != NULL) *misses = guiLayoutCache.misses;
+}
+
+// Unload layouts cache (calling thread)
+void GuiUnloadLayoutCache(void)
+{
+    for (int i = 0; i < guiLayoutCache.capacity; i++) RAYGUI_FREE(guiLayoutCache.entries[i].cells);
+
+    RAYGUI_FREE(guiLayoutCache.entries);
+    memset(&guiLayoutCache, 0, sizeof(GuiLayoutCache));
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Add data to layout signature (FNV-1a)
+static unsigned int GuiHashLayout(unsigned int hash, const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++) hash = (hash ^ bytes[i])*16777619u;
+
+    return hash;
+}
+
+// Compute layout items signature
+// NOTE: Text items hash text content (not text pointer), text measurement generation changes with font
+static unsigned int GuiLayoutSignature(int direction, Rectangle bounds, const GuiLayoutItem *items, int count, unsigned int hash)
+{
+    int params[6] = { direction, count, GuiGetStyle(DEFAULT, LAYOUT_PADDING), GuiGetStyle(DEFAULT, LAYOUT_SPACING), 0, 0 };
+    bool hasText = false;
+
+    for (int i = 0; (i < count) && !hasText; i++) hasText = (items[i].mode == GUI_LAYOUT_TEXT);
+
+    if (hasText)
+    {
+        params[4] = GuiGetStyle(DEFAULT, TEXT_SIZE) | (GuiGetStyle(DEFAULT, TEXT_SPACING) << 16);
+        params[5] = GuiGetStyle(DEFAULT, TEXT_PADDING) ^ (int)(guiTextMeasureGeneration << 8);
+    }
+
+    hash = GuiHashLayout(hash, params, sizeof(params));
+    hash = GuiHashLayout(hash, &bounds, sizeof(Rectangle));
+
+    for (int i = 0; i < count; i++)
+    {
+        hash = GuiHashLayout(hash, &items[i].mode, sizeof(int));
+
+        if (items[i].mode == GUI_LAYOUT_TEXT)
+        {
+            if (items[i].text != NULL) hash = GuiHashLayout(hash, items[i].text, (int)strlen(items[i].text) + 1);
+        }
+        else hash = GuiHashLayout(hash, &items[i].value, sizeof(float));
+    }
+
+    return hash;
+}
+
+// Get cached layout entry, inserted if not found
+// NOTE: Entries pointers are only valid until next call (cache could grow), id 0 is never cached
+static GuiLayoutEntry *GuiGetLayoutEntry(unsigned int id)
+{
+    if (id == 0) return NULL;
+
+    // Keep cache load under 75%, probing sequences remain short
+    if ((guiLayoutCache.count + 1)*4 > guiLayoutCache.capacity*3)
+    {
+        int capacity = (guiLayoutCache.capacity == 0)? GUI_LAYOUT_CACHE_SIZE : guiLayoutCache.capacity*2;
+        GuiLayoutEntry *entries = (GuiLayoutEntry *)RAYGUI_CALLOC(capacity, sizeof(GuiLayoutEntry));
+
+        if (entries != NULL)
+        {
+            unsigned int mask = capacity - 1;
+
+            for (int i = 0; i < guiLayoutCache.capacity; i++)
+            {
+                if (guiLayoutCache.entries[i].id == 0) continue;
+
+                unsigned int k = guiLayoutCache.entries[i].id & mask;
+                while (entries[k].id != 0) k = (k + 1) & mask;
+
+                entries[k] = guiLayoutCache.entries[i];
+            }
+
+            RAYGUI_FREE(guiLayoutCache.entries);
+            guiLayoutCache.entries = entries;
+            guiLayoutCache.capacity = capacity;
+        }
+        else if (guiLayoutCache.capacity == 0) return NULL;
+    }
+
+    unsigned int mask = guiLayoutCache.capacity - 1;
+
+    for (unsigned int i = id & mask; ; i = (i + 1) & mask)
+    {
+        GuiLayoutEntry *entry = &guiLayoutCache.entries[i];
+
+        if (entry->id == id) return entry;
+        else if (entry->id == 0)
+        {
+            if ((guiLayoutCache.count + 1)*4 > guiLayoutCache.capacity*3) return NULL;     // Cache could not grow
+
+            entry->id = id;
+            guiLayoutCache.count++;
+
+            return entry;
+        }
+    }
+}
+
+// Make sure cached layout has capacity for `count` cells
+static bool GuiReserveLayoutCells(GuiLayoutEntry *entry, int count)
+{
+    if (count <= entry->cellsCapacity) return true;
+
+    Rectangle *cells = (Rectangle *)RAYGUI_REALLOC(entry->cells, count*sizeof(Rectangle));
+    if (cells == NULL) return false;
+
+    entry->cells = cells;
+    entry->cellsCapacity = count;
+
+    return true;
+}
+
+// Measure items sizes along layout direction (measure pass)
+// NOTE: Fixed and text items get their own size, flex items share remaining length by weight
+static void GuiMeasureLayout(int direction, const GuiLayoutItem *items, int count, float length, float *sizes)
+{
+    float used = 0.0f;
+    float weights = 0.0f;
+
+    for (int i = 0; i < count; i++)
+    {
+        sizes[i] = 0.0f;
+
+        if (items[i].mode == GUI_LAYOUT_FIXED) sizes[i] = items[i].value;
+        else if (items[i].mode == GUI_LAYOUT_TEXT)
+        {
+            if (direction == GUI_LAYOUT_ROW) sizes[i] = (float)GetTextWidth(items[i].text);
+            else sizes[i] = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+            sizes[i] += 2*GuiGetStyle(DEFAULT, TEXT_PADDING);
+        }
+        else if ((items[i].mode == GUI_LAYOUT_FLEX) && (items[i].value > 0.0f)) weights += items[i].value;
+
+        used += sizes[i];
+    }
+
+    float remaining = length - used;
+
+    if ((weights > 0.0f) && (remaining > 0.0f))
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if ((items[i].mode == GUI_LAYOUT_FLEX) && (items[i].value > 0.0f)) sizes[i] = remaining*items[i].value/weights;
+        }
+    }
+}
+
+// Measure and arrange items inside bounds (arrange pass)
+// NOTE: Cells edges are rounded to pixels, so adjacent cells do not overlap or leave gaps
+static void GuiArrangeLayout(int direction, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells)
+{
+    int padding = GuiGetStyle(DEFAULT, LAYOUT_PADDING);
+    int spacing = GuiGetStyle(DEFAULT, LAYOUT_SPACING);
+
+    Rectangle content = { bounds.x + padding, bounds.y + padding, bounds.width - 2*padding, bounds.height - 2*padding };
+    if (content.width < 0) content.width = 0;
+    if (content.height < 0) content.height = 0;
+
+    float length = ((direction == GUI_LAYOUT_ROW)? content.width : content.height) - spacing*(count - 1);
+
+    // NOTE: Flex items require all fixed sizes first, sizes are kept for arrange pass
+    float batch[GUI_LAYOUT_MEASURE_BATCH];
+    float *sizes = batch;
+    if (count > GUI_LAYOUT_MEASURE_BATCH) sizes = (float *)RAYGUI_MALLOC(count*sizeof(float));
+    if (sizes == NULL) { memset(cells, 0, count*sizeof(Rectangle)); return; }
+
+    GuiMeasureLayout(direction, items, count, length, sizes);
+
+    float position = (direction == GUI_LAYOUT_ROW)? content.x : content.y;
+
+    for (int i = 0; i < count; i++)
+    {
+        float start = floorf(position + 0.5f);
+        float end = floorf(position + sizes[i] + 0.5f);
+
+        if (direction == GUI_LAYOUT_ROW) cells[i] = RAYGUI_CLITERAL(Rectangle){ start, content.y, end - start, content.height };
+        else cells[i] = RAYGUI_CLITERAL(Rectangle){ content.x, start, content.width, end - start };
+
+        position += (sizes[i] + spacing);
+    }
+
+    if (sizes != batch) RAYGUI_FREE(sizes);
+}
+
+// Arrange items along direction inside bounds, cells copied from cache if layout inputs did not change
+static void GuiLayoutLine(int direction, unsigned int id, Rectangle bounds, const GuiLayoutItem *items, int count, Rectangle *cells)
+{
+    if (count <= 0) return;
+
+    unsigned int signature = GuiLayoutSignature(direction, bounds, items, count, 2166136261u);
+    GuiLayoutEntry *entry = GuiGetLayoutEntry(id);
+
+    if ((entry != NULL) && (entry->signature == signature) && (entry->cellsCount == count))
+    {
+        memcpy(cells, entry->cells, count*sizeof(Rectangle));
+        guiLayoutCache.hits++;
+        return;
+    }
+
+    GuiArrangeLayout(direction, bounds, items, count, cells);
+    guiLayoutCache.misses++;
+
+    if ((entry != NULL) && GuiReserveLayoutCells(entry, count))
+    {
+        memcpy(entry->cells, cells, count*sizeof(Rectangle));
+        entry->cellsCount = count;
+        entry->signature = signature;
+    }
+}
+
+#endif // GUI_LAYOUT_IMPLEMENTATION
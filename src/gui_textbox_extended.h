@@ -8,6 +8,11 @@
 *
 *   On game draw call:  GuiTextBoxEx(...);
 *
+*   For big texts, edit a GuiTextBuffer (gap buffer) with GuiTextBoxBufferEx(...): insertions and
+*   deletions at cursor are O(1) amortized and only the visible part of the text is measured and drawn.
+*   GuiTextBoxMultiBufferEx(...) edits it as multiline text with vertical scroll: the buffer keeps an index
+*   of wrapped lines, updated incrementally on edits, so only the lines inside the control are measured and drawn.
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2019 Vlad Adrian (@Demizdor) and Ramon Santamaria (@raysan5)
@@ -49,6 +54,27 @@ typedef struct GuiTextBoxState {
     int select;      // Marks position of cursor when selection has started
 } GuiTextBoxState;
 
+// Text buffer (gap buffer) with its editing state, required by GuiTextBoxBufferEx()
+// NOTE: Text is split by the gap in [0, gapStart) and [gapEnd, size), edits move the gap to the edit
+// position, so consecutive edits at the same position do not move any text. All positions are byte indexes.
+typedef struct GuiTextBuffer {
+    char *data;      // Text data, including gap
+    int size;        // Data size in bytes (text + gap)
+    int gapStart;    // Gap start byte index
+    int gapEnd;      // Gap end byte index (exclusive)
+    int maxLength;   // Maximum text length in bytes (0 for no limit)
+    int cursor;      // Cursor position in text
+    int select;      // Marks position of cursor when selection has started (-1 if no selection)
+    int start;       // Text start position (from where we begin drawing the text)
+    int *lines;      // Wrapped lines start byte index, required by GuiTextBoxMultiBufferEx()
+    int linesCount;  // Wrapped lines count (at least 1 when lines index is built)
+    int linesCapacity;  // Wrapped lines allocated capacity
+    int wrapWidth;   // Width used to wrap lines, lines index is rebuilt when it changes (0 if not built)
+    int wrapTextSize;   // Text size used to wrap lines
+    int wrapTextSpacing;    // Text spacing used to wrap lines
+    int scroll;      // First visible line
+} GuiTextBuffer;
+
 #ifdef __cplusplus
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -56,8 +82,8 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
-RAYGUIDEF void GuiTextBoxSetActive(Rectangle bounds);                   // Sets the active textbox
-RAYGUIDEF Rectangle GuiTextBoxGetActive(void);                          // Get bounds of active textbox
+RAYGUIDEF void GuiTextBoxSetActive(unsigned int id);                    // Sets the active textbox (id from GuiGetIdPtr(text), 0 for none)
+RAYGUIDEF unsigned int GuiTextBoxGetActive(void);                       // Get id of active textbox
 
 RAYGUIDEF void GuiTextBoxSetCursor(int cursor);                         // Set cursor position of active textbox
 RAYGUIDEF int GuiTextBoxGetCursor(void);                                // Get cursor position of active textbox
@@ -65,7 +91,7 @@ RAYGUIDEF int GuiTextBoxGetCursor(void);                                // Get c
 RAYGUIDEF void GuiTextBoxSetSelection(int start, int length);           // Set selection of active textbox
 RAYGUIDEF Vector2 GuiTextBoxGetSelection(void);                         // Get selection of active textbox (x - selection start  y - selection length)
 
-RAYGUIDEF bool GuiTextBoxIsActive(Rectangle bounds);                    // Returns true if a textbox control with specified `bounds` is the active textbox
+RAYGUIDEF bool GuiTextBoxIsActive(unsigned int id);                     // Returns true if a textbox control with specified `id` is the active textbox
 RAYGUIDEF GuiTextBoxState GuiTextBoxGetState(void);                     // Get state for the active textbox
 RAYGUIDEF void GuiTextBoxSetState(GuiTextBoxState state);               // Set state for the active textbox (state must be valid else things will break)
 
@@ -78,6 +104,17 @@ RAYGUIDEF int GuiTextBoxGetByteIndex(const char *text, int start, int from, int
 
 RAYGUIDEF bool GuiTextBoxEx(Rectangle bounds, char *text, int textSize, bool editMode);
 
+RAYGUIDEF GuiTextBuffer *GuiCreateTextBuffer(const char *text, int maxLength);  // Create text buffer with initial text (could be NULL), maxLength in bytes (0 for no limit)
+RAYGUIDEF void GuiDestroyTextBuffer(GuiTextBuffer *buffer);              // Destroy text buffer
+RAYGUIDEF int GuiGetTextBufferLength(const GuiTextBuffer *buffer);       // Get text buffer length in bytes
+RAYGUIDEF const char *GuiGetTextBufferText(GuiTextBuffer *buffer);       // Get text buffer text (null-terminated), gap is moved to the end
+RAYGUIDEF int GuiGetTextBufferRange(const GuiTextBuffer *buffer, int start, int length, char *out);     // Copy text range into `out` (not null-terminated), returns bytes copied
+RAYGUIDEF int GuiTextBufferInsert(GuiTextBuffer *buffer, int index, const char *text, int length);     // Insert text at byte index, returns bytes inserted (limited by maxLength)
+RAYGUIDEF void GuiTextBufferDelete(GuiTextBuffer *buffer, int index, int length);                      // Delete bytes at byte index
+
+RAYGUIDEF bool GuiTextBoxBufferEx(Rectangle bounds, GuiTextBuffer *buffer, bool editMode);   // Text box control editing a text buffer, returns true on KEY_ENTER or click outside
+RAYGUIDEF bool GuiTextBoxMultiBufferEx(Rectangle bounds, GuiTextBuffer *buffer, bool editMode);  // Text box control with multiple lines editing a text buffer, returns true on click outside
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,7 +134,10 @@ RAYGUIDEF bool GuiTextBoxEx(Rectangle bounds, char *text, int textSize, bool edi
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#if !defined(TEXTBUFFER_MIN_GAP_SIZE)
+    #define TEXTBUFFER_MIN_GAP_SIZE     1024    // Minimum gap size when text buffer grows
+#endif
+#define TEXTBUFFER_PADDING                 4    // Zeroed bytes after text buffer data (UTF8 decoding never reads outside)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -109,21 +149,25 @@ typedef enum {
     GUI_MEASURE_MODE_CURSOR_COORDS
 } GuiMeasureMode;
 
+// Extended textbox state
+// NOTE: Kept on current gui context (allocated on demand), so every context has its own active textbox,
+// blinking cursor frames counter is kept per textbox on control state table (GuiGetStateData())
+typedef struct GuiTextBoxExtState {
+    unsigned int active;            // Id of the currently active textbox (0 for none)
+    GuiTextBoxState state;          // Keeps state of the active textbox
+} GuiTextBoxExtState;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static Rectangle guiTextBoxActive = { 0 };      // Area of the currently active textbox
-
-static GuiTextBoxState guiTextBoxState = {      // Keeps state of the active textbox
-    .cursor = -1,
-    .start = 0,
-    .index = 0,
-    .select = -1 
-};
+// Current context extended textbox state access
+#define guiTextBoxActive        (GuiTextBoxGetExtState()->active)
+#define guiTextBoxState         (GuiTextBoxGetExtState()->state)
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
+static GuiTextBoxExtState *GuiTextBoxGetExtState(void);    // Get current context extended textbox state
 static int GetPrevCodepoint(const char *text, const char *start, int *prev);
 static int GuiMeasureTextBox(const char *text, int length, Rectangle rec, int *pos, int mode);
 static int GuiMeasureTextBoxRev(const char *text, int length, Rectangle rec, int *pos);                 // Highly synchronized with calculations in DrawTextRecEx()
@@ -138,19 +182,42 @@ static inline void MoveTextBoxCursorLeft(const char *text);
 
 static int EncodeCodepoint(unsigned int c, char out[5]);
 
+static void GuiTextBufferMoveGap(GuiTextBuffer *buffer, int index);     // Move text buffer gap to byte index
+static bool GuiTextBufferReserve(GuiTextBuffer *buffer, int bytes);     // Make sure text buffer gap has at least `bytes` size
+static int GuiTextBufferCodepoint(const GuiTextBuffer *buffer, int index, int *bytes);  // Get codepoint at byte index
+static int GuiTextBufferNext(const GuiTextBuffer *buffer, int index);   // Get byte index of next codepoint
+static int GuiTextBufferPrev(const GuiTextBuffer *buffer, int index);   // Get byte index of previous codepoint
+static int GuiTextBufferGlyphWidth(int codepoint);                      // Get codepoint glyph width, synchronized with GuiMeasureTextBox()
+static void GuiTextBufferScrollToCursor(GuiTextBuffer *buffer, Rectangle textRec);  // Update text start to make cursor visible
+static void GuiTextBufferDeleteSelection(GuiTextBuffer *buffer);        // Delete selected text, if any
+static void GuiTextBufferCopySelection(const GuiTextBuffer *buffer);    // Copy selected text to clipboard
+static int GuiTextBufferGetCursorFromMouse(const GuiTextBuffer *buffer, Rectangle textRec, float mouseX);    // Get cursor byte index from mouse position
+
+static void GuiTextBufferGlyphWidths(int *widths);                      // Get glyph widths for ASCII codepoints (128 values)
+static int GuiTextBufferWrapLine(const GuiTextBuffer *buffer, int start, const int *widths, int *scanEnd);  // Get next wrapped line start byte index (-1 if text ends)
+static bool GuiTextBufferReserveLines(GuiTextBuffer *buffer, int count);    // Make sure lines index has capacity for `count` lines
+static void GuiTextBufferBuildLines(GuiTextBuffer *buffer, int wrapWidth);  // Build wrapped lines index for all text
+static void GuiTextBufferUpdateLines(GuiTextBuffer *buffer, int index, int removed, int inserted);   // Update wrapped lines index after an edit
+static int GuiTextBufferFindLine(const GuiTextBuffer *buffer, int index);   // Get wrapped line containing byte index
+static int GuiTextBufferLineEnd(const GuiTextBuffer *buffer, int line);     // Get last cursor position in wrapped line
+static int GuiTextBufferLineCursor(const GuiTextBuffer *buffer, int line, int offsetX);    // Get cursor byte index in wrapped line from horizontal offset
+static int GuiTextBufferMeasure(const GuiTextBuffer *buffer, int start, int end);  // Measure text range width (single line)
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
 
 // Sets the active textbox (reseting state of the previous active textbox)
-RAYGUIDEF void GuiTextBoxSetActive(Rectangle bounds)
+// NOTE: Textbox id is got from its text pointer (GuiGetIdPtr(text)) or its buffer pointer for GuiTextBuffer
+// textboxes, on the id scope where the textbox is drawn, so textboxes could be moved or share bounds
+RAYGUIDEF void GuiTextBoxSetActive(unsigned int id)
 {
-    guiTextBoxActive = bounds;
+    guiTextBoxActive = id;
     guiTextBoxState = (GuiTextBoxState){ .cursor = -1, .start = 0, .index = 0, .select = -1 };
 }
 
-// Gets bounds of active textbox
-RAYGUIDEF Rectangle GuiTextBoxGetActive(void) { return guiTextBoxActive; }
+// Gets id of active textbox
+RAYGUIDEF unsigned int GuiTextBoxGetActive(void) { return guiTextBoxActive; }
 
 // Set cursor position of active textbox
 RAYGUIDEF void GuiTextBoxSetCursor(int cursor)
@@ -181,12 +248,8 @@ RAYGUIDEF Vector2 GuiTextBoxGetSelection(void)
     return RAYGUI_CLITERAL(Vector2){ guiTextBoxState.cursor, guiTextBoxState.select - guiTextBoxState.cursor };
 }
 
-// Returns true if a textbox control with specified `bounds` is the active textbox
-RAYGUIDEF bool GuiTextBoxIsActive(Rectangle bounds)
-{
-    return (bounds.x == guiTextBoxActive.x && bounds.y == guiTextBoxActive.y &&
-            bounds.width == guiTextBoxActive.width && bounds.height == guiTextBoxActive.height);
-}
+// Returns true if a textbox control with specified `id` is the active textbox
+RAYGUIDEF bool GuiTextBoxIsActive(unsigned int id) { return ((id != 0) && (id == guiTextBoxActive)); }
 
 RAYGUIDEF GuiTextBoxState GuiTextBoxGetState(void) { return guiTextBoxState; }
 RAYGUIDEF void GuiTextBoxSetState(GuiTextBoxState state)
@@ -394,14 +457,15 @@ RAYGUIDEF void GuiTextBoxCut(char* text)
 }
 
 // A text box control supporting text selection, cursor positioning and commonly used keyboard shortcuts.
-// NOTE 1: Requires static variables: framesCounter
+// NOTE 1: Blinking cursor frames counter is kept per textbox on control state table while editing
 // NOTE 2: Returns if KEY_ENTER pressed (useful for data validation)
 RAYGUIDEF bool GuiTextBoxEx(Rectangle bounds, char *text, int textSize, bool editMode)
 {
     // Define the cursor movement/selection speed when movement keys are held/pressed
     #define TEXTBOX_CURSOR_COOLDOWN   5
 
-    static int framesCounter = 0;           // Required for blinking cursor
+    unsigned int id = GuiGetIdPtr(text);            // Textbox id, independent of its bounds
+    int framesCounter = editMode? *(int *)GuiGetStateData(id) : 0;     // Required for blinking cursor, kept per textbox
 
     GuiControlState state = guiState;
     bool pressed = false;
@@ -437,7 +501,7 @@ RAYGUIDEF bool GuiTextBoxEx(Rectangle bounds, char *text, int textSize, bool edi
                           GuiGetStyle(DEFAULT, TEXT_SIZE) };
 
     Vector2 cursorPos = { textRec.x, textRec.y };   // This holds the coordinates inside textRec of the cursor at current position and will be recalculated later
-    bool active = GuiTextBoxIsActive(bounds);       // Check if this textbox is the global active textbox
+    bool active = GuiTextBoxIsActive(id);           // Check if this textbox is the global active textbox
 
     int selStart = 0, selLength = 0, textStartIndex = 0;
 
@@ -457,14 +521,13 @@ RAYGUIDEF bool GuiTextBoxEx(Rectangle bounds, char *text, int textSize, bool edi
                 {
                     // Hurray!!! we just became the active textbox
                     active = true;
-                    GuiTextBoxSetActive(bounds);
+                    GuiTextBoxSetActive(id);
                 }
             }
             else if (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
             {
                 // When active and the right mouse is clicked outside the textbox we should deactivate it
-                // NOTE: We set a dummy rect as the active textbox bounds
-                GuiTextBoxSetActive(RAYGUI_CLITERAL(Rectangle){ 0, 0, -1, -1 });
+                GuiTextBoxSetActive(0);
                 active = false;
             }
 
@@ -807,266 +870,1535 @@ RAYGUIDEF bool GuiTextBoxEx(Rectangle bounds, char *text, int textSize, bool edi
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)));
 
     if (state == GUI_STATE_PRESSED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_FOCUSED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_FOCUSED));
 
         // Draw blinking cursor
         if (editMode && active && ((framesCounter/TEXTEDIT_CURSOR_BLINK_FRAMES)%2 == 0) && selLength == 0)
         {
-            DrawRectangle(cursorPos.x, cursorPos.y, 1, GuiGetStyle(DEFAULT, TEXT_SIZE)*2, Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)), guiAlpha));
+            GuiDrawRectangle(cursorPos.x, cursorPos.y, 1, GuiGetStyle(DEFAULT, TEXT_SIZE)*2, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
         }
     }
     else if (state == GUI_STATE_DISABLED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
     }
 
     // Finally draw the text and selection
-    DrawTextRecEx(guiFont, &text[textStartIndex], textRec, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), false, Fade(GetColor(GuiGetStyle(TEXTBOX, TEXT + (state*3))), guiAlpha), selStart, selLength, GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_FG)), GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_BG)));
+    GuiDrawTextRec(&text[textStartIndex], textRec, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), false, GuiGetStyleColor(TEXTBOX, TEXT + (state*3)), selStart, selLength, GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_FG)), GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_BG)));
+
+    // State is only kept while editing, leaving edit mode releases it
+    if (editMode && !pressed) *(int *)GuiGetStateData(id) = framesCounter;
+    else GuiRemoveStateData(id);
 
     return pressed;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-
-static int GetPrevCodepoint(const char *text, const char *start, int *prev)
+// Create text buffer with initial text (could be NULL)
+// NOTE: maxLength limits text length in bytes, 0 for no limit
+RAYGUIDEF GuiTextBuffer *GuiCreateTextBuffer(const char *text, int maxLength)
 {
-    int c = 0x3f;
-    char *p = (char *)text;
-    *prev = 1;
+    int length = (text != NULL)? (int)strlen(text) : 0;
 
-    for (int i = 0; (p >= start) && (i < 4); p--, i++)
+    if ((maxLength > 0) && (length > maxLength))
     {
-        if ((((unsigned char)*p) >> 6) != 2)
-        {
-            c = GetNextCodepoint(p, prev);
-            break;
-        }
+        length = maxLength;
+        while ((length > 0) && (((unsigned char)text[length] & 0xc0) == 0x80)) length--;   // Avoid splitting UTF8 sequences
     }
 
-    return c;
-}
+    GuiTextBuffer *buffer = (GuiTextBuffer *)RAYGUI_CALLOC(1, sizeof(GuiTextBuffer));
+    if (buffer == NULL) return NULL;
 
-// Returns total number of characters(codepoints) in a UTF8 encoded `text` until `\0` or a `\n` is found.
-// NOTE: If a invalid UTF8 sequence is encountered a `?`(0x3f) codepoint is counted instead.
-static inline unsigned int GuiCountCodepointsUntilNewline(const char *text)
-{
-    unsigned int len = 0;
-    char *ptr = (char*)&text[0];
+    buffer->size = length + TEXTBUFFER_MIN_GAP_SIZE;
+    buffer->data = (char *)RAYGUI_CALLOC(buffer->size + TEXTBUFFER_PADDING, 1);
 
-    while ((*ptr != '\0') && (*ptr != '\n'))
+    if (buffer->data == NULL)
     {
-        int next = 0;
-        int letter = GetNextCodepoint(ptr, &next);
-
-        if (letter == 0x3f) ptr += 1;
-        else ptr += next;
-        ++len;
+        RAYGUI_FREE(buffer);
+        return NULL;
     }
 
-    return len;
+    if (length > 0) memcpy(buffer->data, text, length);
+
+    buffer->gapStart = length;
+    buffer->gapEnd = buffer->size;
+    buffer->maxLength = maxLength;
+    buffer->cursor = length;
+    buffer->select = -1;
+    buffer->start = 0;
+
+    return buffer;
 }
 
-// Highly synchronized with calculations in DrawTextRecEx()
-static int GuiMeasureTextBox(const char *text, int length, Rectangle rec, int *pos, int mode)
+// Destroy text buffer
+RAYGUIDEF void GuiDestroyTextBuffer(GuiTextBuffer *buffer)
 {
-    // Get gui font properties
-    const Font font = guiFont;
-    const float fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
-    const float spacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+    if (buffer == NULL) return;
 
-    int textOffsetX = 0;        // Offset between characters
-    float scaleFactor = 0.0f;
-
-    int letter = 0;   // Current character
-    int index = 0;    // Index position in sprite font
+    RAYGUI_FREE(buffer->lines);
+    RAYGUI_FREE(buffer->data);
+    RAYGUI_FREE(buffer);
+}
 
-    scaleFactor = fontSize/font.baseSize;
+// Get text buffer length in bytes
+RAYGUIDEF int GuiGetTextBufferLength(const GuiTextBuffer *buffer)
+{
+    return (buffer != NULL)? buffer->size - (buffer->gapEnd - buffer->gapStart) : 0;
+}
 
-    int i = 0, k = 0;
-    int glyphWidth = 0;
+// Get text buffer text (null-terminated)
+// NOTE: Gap is moved to the end of the text (all text after previous edit position is moved),
+// returned pointer is valid until next buffer edit
+RAYGUIDEF const char *GuiGetTextBufferText(GuiTextBuffer *buffer)
+{
+    if (buffer == NULL) return NULL;
 
-    for (i = 0; i < length; i++, k++)
-    {
-        glyphWidth = 0;
-        int next = 1;
-        letter = GetNextCodepoint(&text[i], &next);
-        if (letter == 0x3f) next = 1;
-        index = GetGlyphIndex(font, letter);
-        i += next - 1;
+    int length = GuiGetTextBufferLength(buffer);
 
-        if (letter != '\n')
-        {
-            glyphWidth = (font.chars[index].advanceX == 0)?
-                         (int)(font.recs[index].width*scaleFactor + spacing):
-                         (int)(font.chars[index].advanceX*scaleFactor + spacing);
+    GuiTextBufferMoveGap(buffer, length);
+    if (!GuiTextBufferReserve(buffer, 1)) return NULL;
 
-            if ((textOffsetX + glyphWidth + 1) >= rec.width) break;
+    buffer->data[length] = '\0';
 
-            if ((mode == GUI_MEASURE_MODE_CURSOR_POS) && (*pos == k)) break;
-            else if (mode == GUI_MEASURE_MODE_CURSOR_COORDS)
-            {
-                // Check if the mouse pointer is inside the glyph rect
-                Rectangle grec = {rec.x + textOffsetX - 1, rec.y, glyphWidth, (font.baseSize + font.baseSize/2)*scaleFactor - 1 };
-                Vector2 mouse = GetMousePosition();
+    return buffer->data;
+}
 
-                if (CheckCollisionPointRec(mouse, grec))
-                {
-                    // Smooth selection by dividing the glyph rectangle into 2 equal parts and checking where the mouse resides
-                    if (mouse.x > (grec.x + glyphWidth/2))
-                    {
-                        textOffsetX += glyphWidth;
-                        k++;
-                    }
+// Copy text range into `out` (not null-terminated), returns bytes copied
+RAYGUIDEF int GuiGetTextBufferRange(const GuiTextBuffer *buffer, int start, int length, char *out)
+{
+    int textLength = GuiGetTextBufferLength(buffer);
 
-                    break;
-                }
-            }
-        }
-        else break;
+    if (start < 0) { length += start; start = 0; }
+    if ((start + length) > textLength) length = textLength - start;
+    if ((length <= 0) || (out == NULL)) return 0;
 
-        textOffsetX += glyphWidth;
-    }
+    // Copy part before gap, then part after gap
+    int before = (start < buffer->gapStart)? buffer->gapStart - start : 0;
+    if (before > length) before = length;
 
-    *pos = k;
+    if (before > 0) memcpy(out, buffer->data + start, before);
+    if (length > before) memcpy(out + before, buffer->data + (start + before) + (buffer->gapEnd - buffer->gapStart), length - before);
 
-    return (rec.x + textOffsetX - 1);
+    return length;
 }
 
-// Required by GuiTextBoxEx()
-// Highly synchronized with calculations in DrawTextRecEx()
-static int GuiMeasureTextBoxRev(const char *text, int length, Rectangle rec, int *pos)
+// Insert text at byte index, returns bytes inserted (limited by buffer maxLength)
+// NOTE: Positions after index are shifted, cursor at index is moved after inserted text
+RAYGUIDEF int GuiTextBufferInsert(GuiTextBuffer *buffer, int index, const char *text, int length)
 {
-    // Get gui font properties
-    const Font font = guiFont;
-    const float fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
-    const float spacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
-
-    int textOffsetX = 0;        // Offset between characters
-    float scaleFactor = 0.0f;
+    if ((buffer == NULL) || (text == NULL) || (length <= 0)) return 0;
 
-    int letter = 0;   // Current character
-    int index = 0;    // Index position in sprite font
+    int textLength = GuiGetTextBufferLength(buffer);
 
-    scaleFactor = fontSize/font.baseSize;
+    if (index < 0) index = 0;
+    else if (index > textLength) index = textLength;
 
-    int i = 0, k = 0;
-    int glyphWidth = 0, prev = 1;
-    for (i = length; i >= 0; i--, k++)
+    if ((buffer->maxLength > 0) && ((textLength + length) > buffer->maxLength))
     {
-        glyphWidth = 0;
-        letter = GetPrevCodepoint(&text[i], &text[0], &prev);
-
-        if (letter == 0x3f) prev = 1;
-        index = GetGlyphIndex(font, letter);
-        i -= prev - 1;
-
-        if (letter != '\n')
-        {
-            glyphWidth = (font.chars[index].advanceX == 0)?
-                         (int)(font.recs[index].width*scaleFactor + spacing):
-                         (int)(font.chars[index].advanceX*scaleFactor + spacing);
-
-            if ((textOffsetX + glyphWidth + 1) >= rec.width) break;
-        }
-        else break;
+        length = buffer->maxLength - textLength;
+        while ((length > 0) && (((unsigned char)text[length] & 0xc0) == 0x80)) length--;   // Avoid splitting UTF8 sequences
 
-        textOffsetX += glyphWidth;
+        if (length <= 0) return 0;
     }
 
-    *pos = k;
+    GuiTextBufferMoveGap(buffer, index);
+    if (!GuiTextBufferReserve(buffer, length)) return 0;
 
-    return (i + prev);
-}
+    memcpy(buffer->data + buffer->gapStart, text, length);
+    buffer->gapStart += length;
 
-// Calculate cursor coordinates based on the cursor position `pos` inside the `text`.
-static inline int GuiTextBoxGetCursorCoordinates(const char *text, int length, Rectangle rec, int pos)
-{
-    return GuiMeasureTextBox(text, length, rec, &pos, GUI_MEASURE_MODE_CURSOR_POS);
-}
+    if (buffer->cursor >= index) buffer->cursor += length;
+    if (buffer->select > index) buffer->select += length;
+    if (buffer->start > index) buffer->start += length;
 
-// Calculate cursor position in textbox based on mouse coordinates.
-static inline int GuiTextBoxGetCursorFromMouse(const char *text, int length, Rectangle rec, int* pos)
-{
-    return GuiMeasureTextBox(text, length, rec, pos, GUI_MEASURE_MODE_CURSOR_COORDS);
-}
+    if (buffer->wrapWidth > 0) GuiTextBufferUpdateLines(buffer, index, 0, length);
 
-// Calculates how many characters is the textbox able to draw inside rec
-static inline int GuiTextBoxMaxCharacters(const char *text, int length, Rectangle rec)
-{
-    int pos = -1;
-    GuiMeasureTextBox(text, length, rec, &pos, GUI_MEASURE_MODE_CURSOR_END);
-    return pos;
+    return length;
 }
 
-static inline void MoveTextBoxCursorRight(const char* text, int length, Rectangle textRec)
+// Delete bytes at byte index
+// NOTE: Positions after deleted text are shifted, positions inside it are moved to index
+RAYGUIDEF void GuiTextBufferDelete(GuiTextBuffer *buffer, int index, int length)
 {
-    // FIXME: Counting codepoints each time we press the key is expensive, find another way
-    int count = GuiCountCodepointsUntilNewline(text);
-    if (guiTextBoxState.cursor < count ) guiTextBoxState.cursor++;
+    int textLength = GuiGetTextBufferLength(buffer);
 
-    const int max = GuiTextBoxMaxCharacters(&text[guiTextBoxState.index], length - guiTextBoxState.index, textRec);
+    if (index < 0) { length += index; index = 0; }
+    if ((index + length) > textLength) length = textLength - index;
+    if (length <= 0) return;
 
-    if ((guiTextBoxState.cursor - guiTextBoxState.start) > max)
+    // Deleting just before the gap (backspace) only requires growing the gap
+    if ((index + length) == buffer->gapStart) buffer->gapStart -= length;
+    else
     {
-        const int cidx = GuiTextBoxGetByteIndex(text, guiTextBoxState.index, guiTextBoxState.start, guiTextBoxState.cursor);
-        int pos = 0;
-        guiTextBoxState.index = GuiMeasureTextBoxRev(text, cidx - 1, textRec, &pos);
-        guiTextBoxState.start = guiTextBoxState.cursor - pos;
+        GuiTextBufferMoveGap(buffer, index);
+        buffer->gapEnd += length;
     }
-}
 
-static inline void MoveTextBoxCursorLeft(const char* text)
-{
-    if (guiTextBoxState.cursor > 0) guiTextBoxState.cursor--;
+    if (buffer->cursor >= (index + length)) buffer->cursor -= length;
+    else if (buffer->cursor > index) buffer->cursor = index;
 
-    if (guiTextBoxState.cursor < guiTextBoxState.start)
-    {
-        int prev = 0;
-        int letter = GetPrevCodepoint(&text[guiTextBoxState.index - 1], text, &prev);
-        if (letter == 0x3f) prev = 1;
-        guiTextBoxState.start--;
-        guiTextBoxState.index -= prev;
-    }
+    if (buffer->select >= (index + length)) buffer->select -= length;
+    else if (buffer->select > index) buffer->select = index;
+
+    if (buffer->start >= (index + length)) buffer->start -= length;
+    else if (buffer->start > index) buffer->start = index;
+
+    if (buffer->wrapWidth > 0) GuiTextBufferUpdateLines(buffer, index, length, 0);
 }
 
-static int EncodeCodepoint(unsigned int c, char out[5])
+// Text box control editing a text buffer, same behaviour and shortcuts than GuiTextBoxEx()
+// NOTE 1: Editing state (cursor, selection, text start) is kept in the buffer, only visible text is measured
+// and drawn, so frame cost does not depend on text length. Line breaks are shown as spaces.
+// NOTE 2: Returns true if KEY_ENTER pressed or clicked outside in edit mode (useful for data validation)
+RAYGUIDEF bool GuiTextBoxBufferEx(Rectangle bounds, GuiTextBuffer *buffer, bool editMode)
 {
-    int len = 0;
-    if (c <= 0x7f)
-    {
-        out[0] = (char)c;
-        len = 1;
-    }
-    else if (c <= 0x7ff)
+    // Define the cursor movement/selection speed when movement keys are held/pressed
+    #define TEXTBOX_CURSOR_COOLDOWN   5
+
+    if (buffer == NULL) return false;
+
+    unsigned int id = GuiGetIdPtr(buffer);          // Textbox id, independent of its bounds
+    int framesCounter = editMode? *(int *)GuiGetStateData(id) : 0;     // Required for blinking cursor, kept per textbox
+
+    GuiControlState state = guiState;
+    bool pressed = false;
+
+    // Make sure we have enough room to draw at least 1 character
+    if ((bounds.width - 2*GuiGetStyle(TEXTBOX, TEXT_INNER_PADDING)) < GuiGetStyle(DEFAULT, TEXT_SIZE))
     {
-        out[0] = (char)(((c >> 6) & 0x1f) | 0xc0);
-        out[1] = (char)((c & 0x3f) | 0x80);
-        len = 2;
+        bounds.width = GuiGetStyle(DEFAULT, TEXT_SIZE) + 2*GuiGetStyle(TEXTBOX, TEXT_INNER_PADDING);
     }
-    else if (c <= 0xffff)
+
+    // Center the text vertically
+    int verticalPadding = (bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH) - GuiGetStyle(DEFAULT, TEXT_SIZE))/2;
+
+    if (verticalPadding < 0)
     {
-        out[0] = (char)(((c >> 12) & 0x0f) | 0xe0);
-        out[1] = (char)(((c >>  6) & 0x3f) | 0x80);
-        out[2] = (char)((c & 0x3f) | 0x80);
-        len = 3;
+        // Make sure the height is sufficient
+        bounds.height = 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH) + GuiGetStyle(DEFAULT, TEXT_SIZE);
+        verticalPadding = 0;
     }
-    else if (c <= 0x10ffff)
+
+    // Calculate the drawing area for the text inside the control `bounds`
+    Rectangle textRec = { bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH) + GuiGetStyle(TEXTBOX, TEXT_INNER_PADDING),
+                          bounds.y + verticalPadding + GuiGetStyle(TEXTBOX, BORDER_WIDTH),
+                          bounds.width - 2*(GuiGetStyle(TEXTBOX, TEXT_INNER_PADDING) + GuiGetStyle(TEXTBOX, BORDER_WIDTH)),
+                          GuiGetStyle(DEFAULT, TEXT_SIZE) };
+
+    bool active = GuiTextBoxIsActive(id);           // Check if this textbox is the global active textbox
+
+    // Make sure state doesn't have invalid values (buffer could be edited externally)
+    int length = GuiGetTextBufferLength(buffer);
+    if ((buffer->cursor < 0) || (buffer->cursor > length)) buffer->cursor = length;
+    if (buffer->select > length) buffer->select = -1;
+    if ((buffer->start < 0) || (buffer->start > length)) buffer->start = 0;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != GUI_STATE_DISABLED) && !guiLocked)
     {
-        out[0] = (char)(((c >> 18) & 0x07) | 0xf0);
-        out[1] = (char)(((c >> 12) & 0x3f) | 0x80);
-        out[2] = (char)(((c >>  6) & 0x3f) | 0x80);
-        out[3] = (char)((c & 0x3f) | 0x80);
-        len = 4;
-    }
+        Vector2 mousePoint = GetMousePosition();
 
-    out[len] = 0;
-    return len;
+        if (editMode)
+        {
+            // Check if we are the global active textbox
+            // A textbox becomes active when the user clicks it
+            if (!active)
+            {
+                if (CheckCollisionPointRec(mousePoint, bounds) && (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)))
+                {
+                    active = true;
+                    GuiTextBoxSetActive(id);
+                }
+            }
+            else if (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
+            {
+                // When active and the right mouse is clicked outside the textbox we should deactivate it
+                GuiTextBoxSetActive(0);
+                active = false;
+            }
+
+            if (active)
+            {
+                state = GUI_STATE_PRESSED;
+                framesCounter++;
+
+                bool selecting = IsKeyDown(KEY_LEFT_SHIFT);
+                bool hasSelection = (buffer->select != -1) && (buffer->select != buffer->cursor);
+
+                // -----------------
+                // HANDLE KEY INPUT
+                // -----------------
+                // Same shortcuts than GuiTextBoxEx(), check it for details
+                if (IsKeyPressed(KEY_RIGHT) || (IsKeyDown(KEY_RIGHT) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN == 0)))
+                {
+                    if (selecting && (buffer->select == -1)) buffer->select = buffer->cursor;   // Mark selection start
+
+                    // Deselect and move cursor to end of selection or move cursor to the right
+                    if (!selecting && hasSelection) { if (buffer->select > buffer->cursor) buffer->cursor = buffer->select; }
+                    else buffer->cursor = GuiTextBufferNext(buffer, buffer->cursor);
+
+                    if (!selecting) buffer->select = -1;
+                    framesCounter = 0;
+                }
+                else if (IsKeyPressed(KEY_LEFT) || (IsKeyDown(KEY_LEFT) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN == 0)))
+                {
+                    if (selecting && (buffer->select == -1)) buffer->select = buffer->cursor;   // Mark selection start
+
+                    // Deselect and move cursor to start of selection or move cursor to the left
+                    if (!selecting && hasSelection) { if (buffer->select < buffer->cursor) buffer->cursor = buffer->select; }
+                    else buffer->cursor = GuiTextBufferPrev(buffer, buffer->cursor);
+
+                    if (!selecting) buffer->select = -1;
+                    framesCounter = 0;
+                }
+                else if (IsKeyPressed(KEY_BACKSPACE) || (IsKeyDown(KEY_BACKSPACE) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN) == 0))
+                {
+                    if (hasSelection) GuiTextBufferDeleteSelection(buffer);
+                    else
+                    {
+                        int prev = GuiTextBufferPrev(buffer, buffer->cursor);
+                        GuiTextBufferDelete(buffer, prev, buffer->cursor - prev);
+                    }
+
+                    buffer->select = -1;
+                }
+                else if (IsKeyPressed(KEY_DELETE) || (IsKeyDown(KEY_DELETE) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN) == 0))
+                {
+                    if (hasSelection) GuiTextBufferDeleteSelection(buffer);
+                    else GuiTextBufferDelete(buffer, buffer->cursor, GuiTextBufferNext(buffer, buffer->cursor) - buffer->cursor);
+
+                    buffer->select = -1;
+                }
+                else if (IsKeyPressed(KEY_HOME) || IsKeyPressed(KEY_END))
+                {
+                    if (!selecting) buffer->select = -1;    // Deselect everything
+                    else if (buffer->select == -1) buffer->select = buffer->cursor;
+
+                    // Move cursor to start or end of text
+                    buffer->cursor = IsKeyPressed(KEY_HOME)? 0 : GuiGetTextBufferLength(buffer);
+                    framesCounter = 0;
+                }
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_A))    // CTRL + A > Select all
+                {
+                    buffer->cursor = GuiGetTextBufferLength(buffer);
+                    buffer->select = (buffer->cursor > 0)? 0 : -1;
+                }
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_C)) GuiTextBufferCopySelection(buffer);    // CTRL + C > Copy selected text to clipboard
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_X))    // CTRL + X > Cut selected text
+                {
+                    GuiTextBufferCopySelection(buffer);
+                    GuiTextBufferDeleteSelection(buffer);
+                }
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_V))    // CTRL + V > Paste clipboard text
+                {
+                    const char *clipText = GetClipboardText();
+
+                    if (clipText != NULL)
+                    {
+                        GuiTextBufferDeleteSelection(buffer);
+                        GuiTextBufferInsert(buffer, buffer->cursor, clipText, (int)strlen(clipText));
+                    }
+                }
+                else if (IsKeyPressed(KEY_ENTER)) pressed = true;
+                else
+                {
+                    int key = GetKeyPressed();
+
+                    if (key >= 32)
+                    {
+                        char out[5] = { 0 };
+                        int size = EncodeCodepoint(key, &out[0]);
+
+                        if (size != 0)
+                        {
+                            GuiTextBufferDeleteSelection(buffer);
+                            GuiTextBufferInsert(buffer, buffer->cursor, out, size);
+                        }
+                    }
+                }
+
+                // -------------
+                // HANDLE MOUSE
+                // -------------
+                if (CheckCollisionPointRec(mousePoint, bounds))
+                {
+                    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                    {
+                        buffer->cursor = GuiTextBufferGetCursorFromMouse(buffer, textRec, mousePoint.x);
+                        buffer->select = -1;
+                    }
+                    else if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
+                    {
+                        if (buffer->select == -1) buffer->select = buffer->cursor;  // Mark start of selection
+
+                        if (CheckCollisionPointRec(mousePoint, textRec)) buffer->cursor = GuiTextBufferGetCursorFromMouse(buffer, textRec, mousePoint.x);
+                        else if ((framesCounter%TEXTBOX_CURSOR_COOLDOWN) == 0)
+                        {
+                            // Dragging outside the `textRec` but still inside bounds, this means that we must move the text
+                            if (mousePoint.x < textRec.x) buffer->cursor = GuiTextBufferPrev(buffer, buffer->cursor);
+                            else buffer->cursor = GuiTextBufferNext(buffer, buffer->cursor);
+                        }
+                    }
+                }
+
+                GuiTextBufferScrollToCursor(buffer, textRec);
+            }
+            else state = GUI_STATE_FOCUSED;
+
+            if (IsKeyPressed(KEY_ENTER) || (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(0))) pressed = true;
+        }
+        else
+        {
+            if (active && IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_C))
+            {
+                // If active copy all text to clipboard even when disabled
+                int select = buffer->select;
+                int cursor = buffer->cursor;
+
+                if ((buffer->select == -1) || (buffer->select == buffer->cursor))
+                {
+                    buffer->select = 0;
+                    buffer->cursor = GuiGetTextBufferLength(buffer);
+                }
+
+                GuiTextBufferCopySelection(buffer);
+
+                buffer->select = select;
+                buffer->cursor = cursor;
+            }
+
+            if (CheckCollisionPointRec(mousePoint, bounds))
+            {
+                state = GUI_STATE_FOCUSED;
+                if (IsMouseButtonPressed(0)) pressed = true;
+            }
+        }
+
+        if (pressed) framesCounter = 0;
+    }
+
+    // Get visible text range and cursor offset, measuring from text start
+    length = GuiGetTextBufferLength(buffer);
+
+    int visibleEnd = buffer->start;
+    int textOffsetX = 0;
+    int cursorOffsetX = 0;
+
+    while (visibleEnd < length)
+    {
+        int bytes = 1;
+        int glyphWidth = GuiTextBufferGlyphWidth(GuiTextBufferCodepoint(buffer, visibleEnd, &bytes));
+
+        if ((textOffsetX + glyphWidth + 1) >= textRec.width) break;
+
+        textOffsetX += glyphWidth;
+        visibleEnd += bytes;
+
+        if (visibleEnd <= buffer->cursor) cursorOffsetX = textOffsetX;
+    }
+
+    // Selection, in characters from visible text start
+    int selStart = 0, selLength = 0;
+
+    if ((state == GUI_STATE_PRESSED) && (buffer->select != -1) && (buffer->select != buffer->cursor))
+    {
+        int selectFrom = (buffer->cursor < buffer->select)? buffer->cursor : buffer->select;
+        int selectTo = (buffer->cursor < buffer->select)? buffer->select : buffer->cursor;
+
+        for (int i = buffer->start, k = 0; i < visibleEnd; i = GuiTextBufferNext(buffer, i), k++)
+        {
+            if (i < selectFrom) selStart = k + 1;
+            else if (i < selectTo) selLength++;
+        }
+    }
+
+    // Copy visible text (contiguous, line breaks replaced by spaces), valid until frame end
+    char *visibleText = (char *)GuiScratchAlloc(visibleEnd - buffer->start + 1);
+
+    if (visibleText != NULL)
+    {
+        int visibleLength = GuiGetTextBufferRange(buffer, buffer->start, visibleEnd - buffer->start, visibleText);
+        for (int i = 0; i < visibleLength; i++) if (visibleText[i] == '\n') visibleText[i] = ' ';
+        visibleText[visibleLength] = '\0';
+    }
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)));
+
+    if (state == GUI_STATE_PRESSED)
+    {
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_FOCUSED));
+
+        // Draw blinking cursor
+        if (editMode && active && ((framesCounter/TEXTEDIT_CURSOR_BLINK_FRAMES)%2 == 0) && selLength == 0)
+        {
+            GuiDrawRectangle(textRec.x + cursorOffsetX - 1, textRec.y, 1, GuiGetStyle(DEFAULT, TEXT_SIZE)*2, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
+        }
+    }
+    else if (state == GUI_STATE_DISABLED)
+    {
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
+    }
+
+    // Finally draw the text and selection
+    if (visibleText != NULL) GuiDrawTextRec(visibleText, textRec, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), false, GuiGetStyleColor(TEXTBOX, TEXT + (state*3)), selStart, selLength, GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_FG)), GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_BG)));
+
+    // State is only kept while editing, leaving edit mode releases it
+    if (editMode && !pressed) *(int *)GuiGetStateData(id) = framesCounter;
+    else GuiRemoveStateData(id);
+
+    return pressed;
+}
+
+// Text box control with multiple lines editing a text buffer
+// NOTE 1: Text is word wrapped to the control width, wrapped lines index is kept in the buffer and
+// updated on edits, only visible lines are measured and drawn, so frame cost does not depend on text length
+// NOTE 2: Returns true if clicked outside in edit mode or clicked inside when not in edit mode
+RAYGUIDEF bool GuiTextBoxMultiBufferEx(Rectangle bounds, GuiTextBuffer *buffer, bool editMode)
+{
+    // Define the cursor movement/selection speed when movement keys are held/pressed
+    #define TEXTBOX_CURSOR_COOLDOWN   5
+    #define TEXTBOX_WHEEL_LINES       3     // Lines scrolled per mouse wheel move
+
+    if (buffer == NULL) return false;
+
+    GuiControlState state = guiState;
+    bool pressed = false;
+
+    const int textSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    const int lineHeight = textSize + GuiGetStyle(TEXTBOX, TEXT_LINES_PADDING);
+    const int padding = GuiGetStyle(TEXTBOX, BORDER_WIDTH) + GuiGetStyle(TEXTBOX, TEXT_INNER_PADDING);
+
+    // Calculate the drawing area for the text inside the control `bounds`
+    // NOTE: Scroll bar space is always reserved, lines index would be rebuilt if text width changes
+    Rectangle textRec = { bounds.x + padding, bounds.y + padding,
+                          bounds.width - 2*padding - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+                          bounds.height - 2*padding };
+
+    if (textRec.width < 1) textRec.width = 1;
+
+    Rectangle scrollBarBounds = {
+        bounds.x + bounds.width - GuiGetStyle(TEXTBOX, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+        bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+        bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH)
+    };
+
+    int visibleLines = (int)textRec.height/lineHeight;
+    if (visibleLines < 1) visibleLines = 1;
+
+    // Make sure lines index is built for current text width and style
+    if ((buffer->wrapWidth != (int)textRec.width) || (buffer->wrapTextSize != textSize) ||
+        (buffer->wrapTextSpacing != GuiGetStyle(DEFAULT, TEXT_SPACING))) GuiTextBufferBuildLines(buffer, (int)textRec.width);
+
+    if (buffer->wrapWidth == 0) return false;   // Lines index could not be allocated
+
+    unsigned int id = GuiGetIdPtr(buffer);          // Textbox id, independent of its bounds
+    int framesCounter = editMode? *(int *)GuiGetStateData(id) : 0;     // Required for blinking cursor, kept per textbox
+    bool active = GuiTextBoxIsActive(id);           // Check if this textbox is the global active textbox
+
+    // Make sure state doesn't have invalid values (buffer could be edited externally)
+    int length = GuiGetTextBufferLength(buffer);
+    if ((buffer->cursor < 0) || (buffer->cursor > length)) buffer->cursor = length;
+    if (buffer->select > length) buffer->select = -1;
+
+    int prevCursor = buffer->cursor;
+    int prevLength = length;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != GUI_STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GetMousePosition();
+
+        // Text can be scrolled with mouse wheel, also when not editing
+        if (CheckCollisionPointRec(mousePoint, bounds)) buffer->scroll -= GetMouseWheelMove()*TEXTBOX_WHEEL_LINES;
+
+        if (editMode)
+        {
+            // Check if we are the global active textbox
+            // A textbox becomes active when the user clicks it
+            if (!active)
+            {
+                if (CheckCollisionPointRec(mousePoint, bounds) && (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)))
+                {
+                    active = true;
+                    GuiTextBoxSetActive(id);
+                }
+            }
+            else if (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_RIGHT_BUTTON))
+            {
+                // When active and the right mouse is clicked outside the textbox we should deactivate it
+                GuiTextBoxSetActive(0);
+                active = false;
+            }
+
+            if (active)
+            {
+                state = GUI_STATE_PRESSED;
+                framesCounter++;
+
+                bool selecting = IsKeyDown(KEY_LEFT_SHIFT);
+                bool hasSelection = (buffer->select != -1) && (buffer->select != buffer->cursor);
+                int line = GuiTextBufferFindLine(buffer, buffer->cursor);
+
+                // -----------------
+                // HANDLE KEY INPUT
+                // -----------------
+                // Same shortcuts than GuiTextBoxBufferEx(), plus UP/DOWN/PAGE_UP/PAGE_DOWN to move between
+                // lines, HOME/END move to line start/end and ENTER adds a line break
+                if (IsKeyPressed(KEY_RIGHT) || (IsKeyDown(KEY_RIGHT) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN == 0)))
+                {
+                    if (selecting && (buffer->select == -1)) buffer->select = buffer->cursor;   // Mark selection start
+
+                    // Deselect and move cursor to end of selection or move cursor to the right
+                    if (!selecting && hasSelection) { if (buffer->select > buffer->cursor) buffer->cursor = buffer->select; }
+                    else buffer->cursor = GuiTextBufferNext(buffer, buffer->cursor);
+
+                    if (!selecting) buffer->select = -1;
+                    framesCounter = 0;
+                }
+                else if (IsKeyPressed(KEY_LEFT) || (IsKeyDown(KEY_LEFT) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN == 0)))
+                {
+                    if (selecting && (buffer->select == -1)) buffer->select = buffer->cursor;   // Mark selection start
+
+                    // Deselect and move cursor to start of selection or move cursor to the left
+                    if (!selecting && hasSelection) { if (buffer->select < buffer->cursor) buffer->cursor = buffer->select; }
+                    else buffer->cursor = GuiTextBufferPrev(buffer, buffer->cursor);
+
+                    if (!selecting) buffer->select = -1;
+                    framesCounter = 0;
+                }
+                else if (IsKeyPressed(KEY_UP) || (IsKeyDown(KEY_UP) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN == 0)) ||
+                         IsKeyPressed(KEY_DOWN) || (IsKeyDown(KEY_DOWN) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN == 0)) ||
+                         IsKeyPressed(KEY_PAGE_UP) || IsKeyPressed(KEY_PAGE_DOWN))
+                {
+                    if (selecting && (buffer->select == -1)) buffer->select = buffer->cursor;   // Mark selection start
+
+                    int target = line;
+                    if (IsKeyPressed(KEY_PAGE_UP)) target -= visibleLines;
+                    else if (IsKeyPressed(KEY_PAGE_DOWN)) target += visibleLines;
+                    else if (IsKeyDown(KEY_UP)) target--;
+                    else target++;
+
+                    if (target < 0) target = 0;
+                    else if (target >= buffer->linesCount) target = buffer->linesCount - 1;
+
+                    // Move cursor to the same horizontal position in target line
+                    buffer->cursor = GuiTextBufferLineCursor(buffer, target, GuiTextBufferMeasure(buffer, buffer->lines[line], buffer->cursor));
+
+                    if (!selecting) buffer->select = -1;
+                    framesCounter = 0;
+                }
+                else if (IsKeyPressed(KEY_BACKSPACE) || (IsKeyDown(KEY_BACKSPACE) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN) == 0))
+                {
+                    if (hasSelection) GuiTextBufferDeleteSelection(buffer);
+                    else
+                    {
+                        int prev = GuiTextBufferPrev(buffer, buffer->cursor);
+                        GuiTextBufferDelete(buffer, prev, buffer->cursor - prev);
+                    }
+
+                    buffer->select = -1;
+                }
+                else if (IsKeyPressed(KEY_DELETE) || (IsKeyDown(KEY_DELETE) && (framesCounter%TEXTBOX_CURSOR_COOLDOWN) == 0))
+                {
+                    if (hasSelection) GuiTextBufferDeleteSelection(buffer);
+                    else GuiTextBufferDelete(buffer, buffer->cursor, GuiTextBufferNext(buffer, buffer->cursor) - buffer->cursor);
+
+                    buffer->select = -1;
+                }
+                else if (IsKeyPressed(KEY_HOME) || IsKeyPressed(KEY_END))
+                {
+                    if (!selecting) buffer->select = -1;    // Deselect everything
+                    else if (buffer->select == -1) buffer->select = buffer->cursor;
+
+                    // Move cursor to start or end of line
+                    buffer->cursor = IsKeyPressed(KEY_HOME)? buffer->lines[line] : GuiTextBufferLineEnd(buffer, line);
+                    framesCounter = 0;
+                }
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_A))    // CTRL + A > Select all
+                {
+                    buffer->cursor = GuiGetTextBufferLength(buffer);
+                    buffer->select = (buffer->cursor > 0)? 0 : -1;
+                }
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_C)) GuiTextBufferCopySelection(buffer);    // CTRL + C > Copy selected text to clipboard
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_X))    // CTRL + X > Cut selected text
+                {
+                    GuiTextBufferCopySelection(buffer);
+                    GuiTextBufferDeleteSelection(buffer);
+                }
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_V))    // CTRL + V > Paste clipboard text
+                {
+                    const char *clipText = GetClipboardText();
+
+                    if (clipText != NULL)
+                    {
+                        GuiTextBufferDeleteSelection(buffer);
+                        GuiTextBufferInsert(buffer, buffer->cursor, clipText, (int)strlen(clipText));
+                    }
+                }
+                else if (IsKeyPressed(KEY_ENTER))
+                {
+                    GuiTextBufferDeleteSelection(buffer);
+                    GuiTextBufferInsert(buffer, buffer->cursor, "\n", 1);
+                }
+                else
+                {
+                    int key = GetKeyPressed();
+
+                    if (key >= 32)
+                    {
+                        char out[5] = { 0 };
+                        int size = EncodeCodepoint(key, &out[0]);
+
+                        if (size != 0)
+                        {
+                            GuiTextBufferDeleteSelection(buffer);
+                            GuiTextBufferInsert(buffer, buffer->cursor, out, size);
+                        }
+                    }
+                }
+
+                // -------------
+                // HANDLE MOUSE
+                // -------------
+                bool overScrollBar = (buffer->linesCount > visibleLines) && CheckCollisionPointRec(mousePoint, scrollBarBounds);
+
+                if (CheckCollisionPointRec(mousePoint, bounds) && !overScrollBar)
+                {
+                    // Get line under mouse, dragging outside `textRec` moves to previous/next line
+                    int mouseLine = buffer->scroll + (int)(mousePoint.y - textRec.y)/lineHeight;
+                    if (mousePoint.y < textRec.y) mouseLine = buffer->scroll - 1;
+
+                    if (mouseLine < 0) mouseLine = 0;
+                    else if (mouseLine >= buffer->linesCount) mouseLine = buffer->linesCount - 1;
+
+                    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                    {
+                        buffer->cursor = GuiTextBufferLineCursor(buffer, mouseLine, mousePoint.x - textRec.x);
+                        buffer->select = -1;
+                    }
+                    else if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
+                    {
+                        if (buffer->select == -1) buffer->select = buffer->cursor;  // Mark start of selection
+
+                        if (CheckCollisionPointRec(mousePoint, textRec) || ((framesCounter%TEXTBOX_CURSOR_COOLDOWN) == 0))
+                        {
+                            buffer->cursor = GuiTextBufferLineCursor(buffer, mouseLine, mousePoint.x - textRec.x);
+                        }
+                    }
+                }
+            }
+            else state = GUI_STATE_FOCUSED;
+
+            // Exit edit mode
+            if (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) pressed = true;
+        }
+        else
+        {
+            if (CheckCollisionPointRec(mousePoint, bounds))
+            {
+                state = GUI_STATE_FOCUSED;
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) pressed = true;
+            }
+        }
+
+        if (pressed) framesCounter = 0;     // Reset blinking cursor
+    }
+
+    // Scroll to make cursor line visible when cursor moved or text changed
+    int cursorLine = GuiTextBufferFindLine(buffer, buffer->cursor);
+
+    if ((buffer->cursor != prevCursor) || (GuiGetTextBufferLength(buffer) != prevLength))
+    {
+        if (cursorLine < buffer->scroll) buffer->scroll = cursorLine;
+        else if (cursorLine >= (buffer->scroll + visibleLines)) buffer->scroll = cursorLine - visibleLines + 1;
+    }
+
+    if (buffer->scroll > (buffer->linesCount - visibleLines)) buffer->scroll = buffer->linesCount - visibleLines;
+    if (buffer->scroll < 0) buffer->scroll = 0;
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)));
+
+    // Selection range, if any
+    int selectFrom = -1, selectTo = -1;
+
+    if ((state == GUI_STATE_PRESSED) && (buffer->select != -1) && (buffer->select != buffer->cursor))
+    {
+        selectFrom = (buffer->cursor < buffer->select)? buffer->cursor : buffer->select;
+        selectTo = (buffer->cursor < buffer->select)? buffer->select : buffer->cursor;
+    }
+
+    if (state == GUI_STATE_PRESSED)
+    {
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_PRESSED));
+
+        // Draw blinking cursor, only if cursor line is visible
+        if (editMode && active && ((framesCounter/TEXTEDIT_CURSOR_BLINK_FRAMES)%2 == 0) && (selectFrom == -1) &&
+            (cursorLine >= buffer->scroll) && (cursorLine < (buffer->scroll + visibleLines)))
+        {
+            GuiDrawRectangle(textRec.x + GuiTextBufferMeasure(buffer, buffer->lines[cursorLine], buffer->cursor) - 1, textRec.y + (cursorLine - buffer->scroll)*lineHeight, 1, textSize + 2, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
+        }
+    }
+    else if (state == GUI_STATE_DISABLED)
+    {
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
+    }
+
+    // Draw visible lines only, line text is copied (without line break) to scratch memory, valid until frame end
+    Color textColor = GuiGetStyleColor(TEXTBOX, TEXT + (state*3));
+    length = GuiGetTextBufferLength(buffer);
+
+    for (int line = buffer->scroll; (line < buffer->linesCount) && (line < (buffer->scroll + visibleLines)); line++)
+    {
+        int lineStart = buffer->lines[line];
+        int lineEnd = (line < (buffer->linesCount - 1))? buffer->lines[line + 1] : length;
+
+        char *lineText = (char *)GuiScratchAlloc(lineEnd - lineStart + 1);
+        if (lineText == NULL) break;
+
+        int lineLength = GuiGetTextBufferRange(buffer, lineStart, lineEnd - lineStart, lineText);
+        if ((lineLength > 0) && (lineText[lineLength - 1] == '\n')) lineLength--;
+        lineText[lineLength] = '\0';
+
+        // Selection, in characters from line start
+        int selStart = 0, selLength = 0;
+
+        if (selectFrom != -1)
+        {
+            for (int i = lineStart, k = 0; i < (lineStart + lineLength); i = GuiTextBufferNext(buffer, i), k++)
+            {
+                if (i < selectFrom) selStart = k + 1;
+                else if (i < selectTo) selLength++;
+            }
+        }
+
+        Rectangle lineRec = { textRec.x, textRec.y + (line - buffer->scroll)*lineHeight, textRec.width, lineHeight };
+
+        GuiDrawTextRec(lineText, lineRec, textSize, GuiGetStyle(DEFAULT, TEXT_SPACING), false, textColor, selStart, selLength, GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_FG)), GetColor(GuiGetStyle(TEXTBOX, COLOR_SELECTED_BG)));
+    }
+
+    // Draw vertical scroll bar, only when required
+    if (buffer->linesCount > visibleLines)
+    {
+        // Slider size is limited to keep it usable for huge texts
+        int sliderSize = (int)(bounds.height*((double)visibleLines/buffer->linesCount));
+        if (sliderSize < GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE)) sliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+
+        buffer->scroll = (int)GuiScrollBarEx(scrollBarBounds, buffer->scroll, 0, buffer->linesCount - visibleLines, 1, sliderSize);
+    }
+    //--------------------------------------------------------------------
+
+    // State is only kept while editing, leaving edit mode releases it
+    if (editMode && !pressed) *(int *)GuiGetStateData(id) = framesCounter;
+    else GuiRemoveStateData(id);
+
+    return pressed;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get current context extended textbox state, allocated on first use
+// NOTE: Memory is released by GuiDestroyContext()
+static GuiTextBoxExtState *GuiTextBoxGetExtState(void)
+{
+    static GuiTextBoxExtState fallback = { 0, { -1, 0, 0, -1 } };    // Used on allocation failure
+
+    if (guiCtx->textBoxExt == NULL)
+    {
+        GuiTextBoxExtState *ext = (GuiTextBoxExtState *)RAYGUI_CALLOC(1, sizeof(GuiTextBoxExtState));
+        if (ext == NULL) return &fallback;
+
+        ext->state = (GuiTextBoxState){ .cursor = -1, .start = 0, .index = 0, .select = -1 };
+        guiCtx->textBoxExt = ext;
+    }
+
+    return (GuiTextBoxExtState *)guiCtx->textBoxExt;
+}
+
+static int GetPrevCodepoint(const char *text, const char *start, int *prev)
+{
+    int c = 0x3f;
+    char *p = (char *)text;
+    *prev = 1;
+
+    for (int i = 0; (p >= start) && (i < 4); p--, i++)
+    {
+        if ((((unsigned char)*p) >> 6) != 2)
+        {
+            c = GetNextCodepoint(p, prev);
+            break;
+        }
+    }
+
+    return c;
+}
+
+// Returns total number of characters(codepoints) in a UTF8 encoded `text` until `\0` or a `\n` is found.
+// NOTE: If a invalid UTF8 sequence is encountered a `?`(0x3f) codepoint is counted instead.
+static inline unsigned int GuiCountCodepointsUntilNewline(const char *text)
+{
+    unsigned int len = 0;
+    char *ptr = (char*)&text[0];
+
+    while ((*ptr != '\0') && (*ptr != '\n'))
+    {
+        int next = 0;
+        int letter = GetNextCodepoint(ptr, &next);
+
+        if (letter == 0x3f) ptr += 1;
+        else ptr += next;
+        ++len;
+    }
+
+    return len;
+}
+
+// Highly synchronized with calculations in DrawTextRecEx()
+static int GuiMeasureTextBox(const char *text, int length, Rectangle rec, int *pos, int mode)
+{
+    // Get gui font properties
+    const Font font = guiFont;
+    const float fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    const float spacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+
+    int textOffsetX = 0;        // Offset between characters
+    float scaleFactor = 0.0f;
+
+    int letter = 0;   // Current character
+    int index = 0;    // Index position in sprite font
+
+    scaleFactor = fontSize/font.baseSize;
+
+    int i = 0, k = 0;
+    int glyphWidth = 0;
+
+    for (i = 0; i < length; i++, k++)
+    {
+        glyphWidth = 0;
+        int next = 1;
+        letter = GetNextCodepoint(&text[i], &next);
+        if (letter == 0x3f) next = 1;
+        index = GetGlyphIndex(font, letter);
+        i += next - 1;
+
+        if (letter != '\n')
+        {
+            glyphWidth = (font.chars[index].advanceX == 0)?
+                         (int)(font.recs[index].width*scaleFactor + spacing):
+                         (int)(font.chars[index].advanceX*scaleFactor + spacing);
+
+            if ((textOffsetX + glyphWidth + 1) >= rec.width) break;
+
+            if ((mode == GUI_MEASURE_MODE_CURSOR_POS) && (*pos == k)) break;
+            else if (mode == GUI_MEASURE_MODE_CURSOR_COORDS)
+            {
+                // Check if the mouse pointer is inside the glyph rect
+                Rectangle grec = {rec.x + textOffsetX - 1, rec.y, glyphWidth, (font.baseSize + font.baseSize/2)*scaleFactor - 1 };
+                Vector2 mouse = GetMousePosition();
+
+                if (CheckCollisionPointRec(mouse, grec))
+                {
+                    // Smooth selection by dividing the glyph rectangle into 2 equal parts and checking where the mouse resides
+                    if (mouse.x > (grec.x + glyphWidth/2))
+                    {
+                        textOffsetX += glyphWidth;
+                        k++;
+                    }
+
+                    break;
+                }
+            }
+        }
+        else break;
+
+        textOffsetX += glyphWidth;
+    }
+
+    *pos = k;
+
+    return (rec.x + textOffsetX - 1);
+}
+
+// Required by GuiTextBoxEx()
+// Highly synchronized with calculations in DrawTextRecEx()
+static int GuiMeasureTextBoxRev(const char *text, int length, Rectangle rec, int *pos)
+{
+    // Get gui font properties
+    const Font font = guiFont;
+    const float fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    const float spacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+
+    int textOffsetX = 0;        // Offset between characters
+    float scaleFactor = 0.0f;
+
+    int letter = 0;   // Current character
+    int index = 0;    // Index position in sprite font
+
+    scaleFactor = fontSize/font.baseSize;
+
+    int i = 0, k = 0;
+    int glyphWidth = 0, prev = 1;
+    for (i = length; i >= 0; i--, k++)
+    {
+        glyphWidth = 0;
+        letter = GetPrevCodepoint(&text[i], &text[0], &prev);
+
+        if (letter == 0x3f) prev = 1;
+        index = GetGlyphIndex(font, letter);
+        i -= prev - 1;
+
+        if (letter != '\n')
+        {
+            glyphWidth = (font.chars[index].advanceX == 0)?
+                         (int)(font.recs[index].width*scaleFactor + spacing):
+                         (int)(font.chars[index].advanceX*scaleFactor + spacing);
+
+            if ((textOffsetX + glyphWidth + 1) >= rec.width) break;
+        }
+        else break;
+
+        textOffsetX += glyphWidth;
+    }
+
+    *pos = k;
+
+    return (i + prev);
+}
+
+// Calculate cursor coordinates based on the cursor position `pos` inside the `text`.
+static inline int GuiTextBoxGetCursorCoordinates(const char *text, int length, Rectangle rec, int pos)
+{
+    return GuiMeasureTextBox(text, length, rec, &pos, GUI_MEASURE_MODE_CURSOR_POS);
+}
+
+// Calculate cursor position in textbox based on mouse coordinates.
+static inline int GuiTextBoxGetCursorFromMouse(const char *text, int length, Rectangle rec, int* pos)
+{
+    return GuiMeasureTextBox(text, length, rec, pos, GUI_MEASURE_MODE_CURSOR_COORDS);
+}
+
+// Calculates how many characters is the textbox able to draw inside rec
+static inline int GuiTextBoxMaxCharacters(const char *text, int length, Rectangle rec)
+{
+    int pos = -1;
+    GuiMeasureTextBox(text, length, rec, &pos, GUI_MEASURE_MODE_CURSOR_END);
+    return pos;
+}
+
+static inline void MoveTextBoxCursorRight(const char* text, int length, Rectangle textRec)
+{
+    // FIXME: Counting codepoints each time we press the key is expensive, find another way
+    int count = GuiCountCodepointsUntilNewline(text);
+    if (guiTextBoxState.cursor < count ) guiTextBoxState.cursor++;
+
+    const int max = GuiTextBoxMaxCharacters(&text[guiTextBoxState.index], length - guiTextBoxState.index, textRec);
+
+    if ((guiTextBoxState.cursor - guiTextBoxState.start) > max)
+    {
+        const int cidx = GuiTextBoxGetByteIndex(text, guiTextBoxState.index, guiTextBoxState.start, guiTextBoxState.cursor);
+        int pos = 0;
+        guiTextBoxState.index = GuiMeasureTextBoxRev(text, cidx - 1, textRec, &pos);
+        guiTextBoxState.start = guiTextBoxState.cursor - pos;
+    }
+}
+
+static inline void MoveTextBoxCursorLeft(const char* text)
+{
+    if (guiTextBoxState.cursor > 0) guiTextBoxState.cursor--;
+
+    if (guiTextBoxState.cursor < guiTextBoxState.start)
+    {
+        int prev = 0;
+        int letter = GetPrevCodepoint(&text[guiTextBoxState.index - 1], text, &prev);
+        if (letter == 0x3f) prev = 1;
+        guiTextBoxState.start--;
+        guiTextBoxState.index -= prev;
+    }
+}
+
+static int EncodeCodepoint(unsigned int c, char out[5])
+{
+    int len = 0;
+    if (c <= 0x7f)
+    {
+        out[0] = (char)c;
+        len = 1;
+    }
+    else if (c <= 0x7ff)
+    {
+        out[0] = (char)(((c >> 6) & 0x1f) | 0xc0);
+        out[1] = (char)((c & 0x3f) | 0x80);
+        len = 2;
+    }
+    else if (c <= 0xffff)
+    {
+        out[0] = (char)(((c >> 12) & 0x0f) | 0xe0);
+        out[1] = (char)(((c >>  6) & 0x3f) | 0x80);
+        out[2] = (char)((c & 0x3f) | 0x80);
+        len = 3;
+    }
+    else if (c <= 0x10ffff)
+    {
+        out[0] = (char)(((c >> 18) & 0x07) | 0xf0);
+        out[1] = (char)(((c >> 12) & 0x3f) | 0x80);
+        out[2] = (char)(((c >>  6) & 0x3f) | 0x80);
+        out[3] = (char)((c & 0x3f) | 0x80);
+        len = 4;
+    }
+
+    out[len] = 0;
+    return len;
+}
+
+// Move text buffer gap to byte index, text between gap and index is moved
+static void GuiTextBufferMoveGap(GuiTextBuffer *buffer, int index)
+{
+    if (index < buffer->gapStart)
+    {
+        int count = buffer->gapStart - index;
+        memmove(buffer->data + buffer->gapEnd - count, buffer->data + index, count);
+        buffer->gapStart -= count;
+        buffer->gapEnd -= count;
+    }
+    else if (index > buffer->gapStart)
+    {
+        int count = index - buffer->gapStart;
+        memmove(buffer->data + buffer->gapStart, buffer->data + buffer->gapEnd, count);
+        buffer->gapStart += count;
+        buffer->gapEnd += count;
+    }
+}
+
+// Make sure text buffer gap has at least `bytes` size, buffer grows (at least doubling) if required
+static bool GuiTextBufferReserve(GuiTextBuffer *buffer, int bytes)
+{
+    if ((buffer->gapEnd - buffer->gapStart) >= bytes) return true;
+
+    int length = GuiGetTextBufferLength(buffer);
+    int size = buffer->size*2;
+    if (size < (length + bytes + TEXTBUFFER_MIN_GAP_SIZE)) size = length + bytes + TEXTBUFFER_MIN_GAP_SIZE;
+
+    char *data = (char *)RAYGUI_REALLOC(buffer->data, size + TEXTBUFFER_PADDING);
+    if (data == NULL) return false;
+
+    // Move text after gap to the end of the new data
+    int tail = buffer->size - buffer->gapEnd;
+    memmove(data + size - tail, data + buffer->gapEnd, tail);
+    memset(data + size, 0, TEXTBUFFER_PADDING);
+
+    buffer->data = data;
+    buffer->gapEnd = size - tail;
+    buffer->size = size;
+
+    return true;
+}
+
+// Get codepoint at byte index, `bytes` returns codepoint size in bytes
+// NOTE: Invalid UTF8 sequences return '?' (0x3f), 1 byte size
+static int GuiTextBufferCodepoint(const GuiTextBuffer *buffer, int index, int *bytes)
+{
+    const char *ptr = buffer->data + ((index < buffer->gapStart)? index : index + (buffer->gapEnd - buffer->gapStart));
+
+    int codepoint = GetNextCodepoint(ptr, bytes);
+    if (codepoint == 0x3f) *bytes = 1;
+
+    // Sequences crossing the gap are invalid (gap is only moved to codepoint boundaries by the textbox)
+    if ((index < buffer->gapStart) && ((index + *bytes) > buffer->gapStart))
+    {
+        codepoint = 0x3f;
+        *bytes = 1;
+    }
+
+    return codepoint;
+}
+
+// Get byte index of next codepoint
+static int GuiTextBufferNext(const GuiTextBuffer *buffer, int index)
+{
+    int length = GuiGetTextBufferLength(buffer);
+    if (index >= length) return length;
+
+    int bytes = 1;
+    GuiTextBufferCodepoint(buffer, index, &bytes);
+
+    return index + bytes;
+}
+
+// Get byte index of previous codepoint
+static int GuiTextBufferPrev(const GuiTextBuffer *buffer, int index)
+{
+    if (index <= 0) return 0;
+
+    // Skip UTF8 continuation bytes (up to 3)
+    int prev = index - 1;
+    for (int k = 0; (k < 3) && (prev > 0); k++)
+    {
+        unsigned char c = (unsigned char)buffer->data[(prev < buffer->gapStart)? prev : prev + (buffer->gapEnd - buffer->gapStart)];
+        if ((c & 0xc0) != 0x80) break;
+        prev--;
+    }
+
+    // Invalid sequences are stepped byte by byte, same as GuiTextBufferNext()
+    int bytes = 1;
+    GuiTextBufferCodepoint(buffer, prev, &bytes);
+    if ((prev + bytes) != index) prev = index - 1;
+
+    return prev;
+}
+
+// Get codepoint glyph width, synchronized with GuiMeasureTextBox()
+// NOTE: Line breaks are measured (and drawn) as spaces
+static int GuiTextBufferGlyphWidth(int codepoint)
+{
+    const float fontSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    const float spacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+    const float scaleFactor = fontSize/guiFont.baseSize;
+
+    int index = GetGlyphIndex(guiFont, (codepoint == '\n')? ' ' : codepoint);
+
+    return (guiFont.chars[index].advanceX == 0)?
+           (int)(guiFont.recs[index].width*scaleFactor + spacing):
+           (int)(guiFont.chars[index].advanceX*scaleFactor + spacing);
+}
+
+// Get cursor byte index from mouse horizontal position, only visible text is measured
+static int GuiTextBufferGetCursorFromMouse(const GuiTextBuffer *buffer, Rectangle textRec, float mouseX)
+{
+    int length = GuiGetTextBufferLength(buffer);
+    int textOffsetX = 0;
+    int index = buffer->start;
+
+    while (index < length)
+    {
+        int bytes = 1;
+        int glyphWidth = GuiTextBufferGlyphWidth(GuiTextBufferCodepoint(buffer, index, &bytes));
+
+        if ((textOffsetX + glyphWidth + 1) >= textRec.width) break;
+
+        // Smooth selection: cursor goes after the glyph when mouse is over its right half
+        if (mouseX < (textRec.x + textOffsetX + glyphWidth/2)) break;
+
+        textOffsetX += glyphWidth;
+        index += bytes;
+    }
+
+    return index;
+}
+
+// Update text start to make cursor visible, only text between start and cursor is measured
+static void GuiTextBufferScrollToCursor(GuiTextBuffer *buffer, Rectangle textRec)
+{
+    if (buffer->start >= buffer->cursor)
+    {
+        buffer->start = buffer->cursor;
+        return;
+    }
+
+    // Check if cursor is visible from current text start
+    int textOffsetX = 0;
+    int index = buffer->start;
+
+    while (index < buffer->cursor)
+    {
+        int bytes = 1;
+        textOffsetX += GuiTextBufferGlyphWidth(GuiTextBufferCodepoint(buffer, index, &bytes));
+
+        if ((textOffsetX + 1) >= textRec.width) break;
+
+        index += bytes;
+    }
+
+    if (index >= buffer->cursor) return;
+
+    // Cursor not visible, measure backwards from cursor to place it at the end of the textbox
+    textOffsetX = 0;
+    index = buffer->cursor;
+
+    while (index > 0)
+    {
+        int prev = GuiTextBufferPrev(buffer, index);
+        int bytes = 1;
+        textOffsetX += GuiTextBufferGlyphWidth(GuiTextBufferCodepoint(buffer, prev, &bytes));
+
+        if ((textOffsetX + 1) >= textRec.width) break;
+
+        index = prev;
+    }
+
+    buffer->start = index;
+}
+
+// Delete selected text, if any (cursor is moved to selection start)
+static void GuiTextBufferDeleteSelection(GuiTextBuffer *buffer)
+{
+    if ((buffer->select != -1) && (buffer->select != buffer->cursor))
+    {
+        int start = (buffer->cursor < buffer->select)? buffer->cursor : buffer->select;
+        int end = (buffer->cursor < buffer->select)? buffer->select : buffer->cursor;
+
+        GuiTextBufferDelete(buffer, start, end - start);
+    }
+
+    buffer->select = -1;
+}
+
+// Copy selected text to clipboard
+// NOTE: Selection is copied into a temporary buffer, no size limits
+static void GuiTextBufferCopySelection(const GuiTextBuffer *buffer)
+{
+    if ((buffer->select == -1) || (buffer->select == buffer->cursor)) return;
+
+    int start = (buffer->cursor < buffer->select)? buffer->cursor : buffer->select;
+    int end = (buffer->cursor < buffer->select)? buffer->select : buffer->cursor;
+
+    char *clipText = (char *)RAYGUI_MALLOC(end - start + 1);
+
+    if (clipText != NULL)
+    {
+        int length = GuiGetTextBufferRange(buffer, start, end - start, clipText);
+        clipText[length] = '\0';
+
+        SetClipboardText(clipText);
+        RAYGUI_FREE(clipText);
+    }
+}
+
+// Get glyph widths for ASCII codepoints (128 values), avoids glyph lookups when wrapping lines
+static void GuiTextBufferGlyphWidths(int *widths)
+{
+    for (int i = 0; i < 128; i++) widths[i] = GuiTextBufferGlyphWidth(i);
+}
+
+// Get next wrapped line start byte index (-1 if text ends before)
+// NOTE 1: Lines are broken after line breaks and after last space when a word does not fit (spaces never
+// wrap), words longer than the line are broken by characters. Wrapping only depends on text after `start`.
+// NOTE 2: `scanEnd` returns the byte index of the last codepoint checked (could be after next line start)
+static int GuiTextBufferWrapLine(const GuiTextBuffer *buffer, int start, const int *widths, int *scanEnd)
+{
+    int length = GuiGetTextBufferLength(buffer);
+    int textOffsetX = 0;
+    int wordStart = -1;     // Byte index after last space in line
+    int index = start;
+
+    while (index < length)
+    {
+        int bytes = 1;
+        int codepoint = (unsigned char)buffer->data[(index < buffer->gapStart)? index : index + (buffer->gapEnd - buffer->gapStart)];
+
+        if (codepoint >= 0x80) codepoint = GuiTextBufferCodepoint(buffer, index, &bytes);
+
+        *scanEnd = index;
+
+        if (codepoint == '\n') return index + bytes;
+
+        int glyphWidth = (codepoint < 128)? widths[codepoint] : GuiTextBufferGlyphWidth(codepoint);
+
+        if ((codepoint != ' ') && (index > start) && ((textOffsetX + glyphWidth + 1) >= buffer->wrapWidth))
+        {
+            return (wordStart > start)? wordStart : index;
+        }
+
+        textOffsetX += glyphWidth;
+        index += bytes;
+
+        if (codepoint == ' ') wordStart = index;
+    }
+
+    *scanEnd = length;     // Text end was reached
+
+    return -1;
+}
+
+// Make sure lines index has capacity for `count` lines
+static bool GuiTextBufferReserveLines(GuiTextBuffer *buffer, int count)
+{
+    if (count <= buffer->linesCapacity) return true;
+
+    int capacity = (buffer->linesCapacity > 0)? buffer->linesCapacity*2 : 64;
+    if (capacity < count) capacity = count;
+
+    int *lines = (int *)RAYGUI_REALLOC(buffer->lines, capacity*sizeof(int));
+    if (lines == NULL) return false;
+
+    buffer->lines = lines;
+    buffer->linesCapacity = capacity;
+
+    return true;
+}
+
+// Build wrapped lines index for all text
+// NOTE: On allocation failure lines index is left not built (wrapWidth = 0)
+static void GuiTextBufferBuildLines(GuiTextBuffer *buffer, int wrapWidth)
+{
+    int widths[128] = { 0 };
+    int scanEnd = 0;
+    GuiTextBufferGlyphWidths(widths);
+
+    buffer->wrapWidth = (wrapWidth > 0)? wrapWidth : 1;
+    buffer->wrapTextSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+    buffer->wrapTextSpacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+    buffer->linesCount = 0;
+
+    for (int start = 0; start >= 0; start = GuiTextBufferWrapLine(buffer, start, widths, &scanEnd))
+    {
+        if (!GuiTextBufferReserveLines(buffer, buffer->linesCount + 1))
+        {
+            buffer->wrapWidth = 0;
+            buffer->linesCount = 0;
+            return;
+        }
+
+        buffer->lines[buffer->linesCount] = start;
+        buffer->linesCount++;
+    }
+}
+
+// Update wrapped lines index after an edit at byte index (text already edited)
+// NOTE: Lines after the edit are shifted, then lines are wrapped again from the first line whose wrapping
+// checks edited text (words could move up to previous lines) until a new line start matches a shifted one,
+// from there wrapping is the same, so only edited lines are measured
+static void GuiTextBufferUpdateLines(GuiTextBuffer *buffer, int index, int removed, int inserted)
+{
+    int widths[128] = { 0 };
+    int scanEnd = 0;
+    GuiTextBufferGlyphWidths(widths);
+
+    int editEnd = index + inserted;
+
+    // Previous lines are not changed if their wrapping doesn't reach edited text
+    int first = GuiTextBufferFindLine(buffer, index);
+
+    while (first > 0)
+    {
+        GuiTextBufferWrapLine(buffer, buffer->lines[first - 1], widths, &scanEnd);
+
+        if (scanEnd < index) break;
+        first--;
+    }
+
+    // Lines starting after removed text are kept, shifted
+    int next = GuiTextBufferFindLine(buffer, (removed > 0)? index + removed - 1 : index) + 1;
+    for (int i = next; i < buffer->linesCount; i++) buffer->lines[i] += (inserted - removed);
+
+    int *newLines = NULL;
+    int newCount = 0;
+    int newCapacity = 0;
+
+    for (int start = GuiTextBufferWrapLine(buffer, buffer->lines[first], widths, &scanEnd); ; start = GuiTextBufferWrapLine(buffer, start, widths, &scanEnd))
+    {
+        if (start < 0)
+        {
+            next = buffer->linesCount;      // Text ends, no more lines kept
+            break;
+        }
+
+        while ((next < buffer->linesCount) && (buffer->lines[next] < start)) next++;
+        if ((start >= editEnd) && (next < buffer->linesCount) && (buffer->lines[next] == start)) break;     // Synchronized
+
+        if (newCount == newCapacity)
+        {
+            newCapacity = (newCapacity > 0)? newCapacity*2 : 16;
+            int *lines = (int *)RAYGUI_REALLOC(newLines, newCapacity*sizeof(int));
+
+            if (lines == NULL)
+            {
+                RAYGUI_FREE(newLines);
+                buffer->wrapWidth = 0;      // Lines index will be built again
+                return;
+            }
+
+            newLines = lines;
+        }
+
+        newLines[newCount] = start;
+        newCount++;
+    }
+
+    // Replace lines between first line and kept lines by new ones
+    int count = buffer->linesCount - (next - (first + 1)) + newCount;
+
+    if (GuiTextBufferReserveLines(buffer, count))
+    {
+        memmove(buffer->lines + first + 1 + newCount, buffer->lines + next, (buffer->linesCount - next)*sizeof(int));
+        if (newCount > 0) memcpy(buffer->lines + first + 1, newLines, newCount*sizeof(int));
+        buffer->linesCount = count;
+    }
+    else buffer->wrapWidth = 0;     // Lines index will be built again
+
+    RAYGUI_FREE(newLines);
+}
+
+// Get wrapped line containing byte index (binary search)
+static int GuiTextBufferFindLine(const GuiTextBuffer *buffer, int index)
+{
+    int low = 0;
+    int high = buffer->linesCount - 1;
+
+    while (low < high)
+    {
+        int mid = (low + high + 1)/2;
+
+        if (buffer->lines[mid] <= index) low = mid;
+        else high = mid - 1;
+    }
+
+    return low;
+}
+
+// Get last cursor position in wrapped line (before line break or last character of wrapped lines)
+static int GuiTextBufferLineEnd(const GuiTextBuffer *buffer, int line)
+{
+    if (line < (buffer->linesCount - 1)) return GuiTextBufferPrev(buffer, buffer->lines[line + 1]);
+
+    return GuiGetTextBufferLength(buffer);
+}
+
+// Get cursor byte index in wrapped line from horizontal offset
+static int GuiTextBufferLineCursor(const GuiTextBuffer *buffer, int line, int offsetX)
+{
+    int end = GuiTextBufferLineEnd(buffer, line);
+    int textOffsetX = 0;
+    int index = buffer->lines[line];
+
+    while (index < end)
+    {
+        int bytes = 1;
+        int glyphWidth = GuiTextBufferGlyphWidth(GuiTextBufferCodepoint(buffer, index, &bytes));
+
+        // Smooth selection: cursor goes after the glyph when offset is over its right half
+        if (offsetX < (textOffsetX + glyphWidth/2)) break;
+
+        textOffsetX += glyphWidth;
+        index += bytes;
+    }
+
+    return index;
+}
+
+// Measure text range width (single line), synchronized with GuiTextBufferWrapLine()
+static int GuiTextBufferMeasure(const GuiTextBuffer *buffer, int start, int end)
+{
+    int width = 0;
+
+    for (int index = start; index < end; )
+    {
+        int bytes = 1;
+        width += GuiTextBufferGlyphWidth(GuiTextBufferCodepoint(buffer, index, &bytes));
+        index += bytes;
+    }
+
+    return width;
 }
 
 #endif // GUI_TEXTBOX_EXTENDED_IMPLEMENTATION
@@ -41,12 +41,37 @@
 *
 *   # Advance Controls
 *       - ListView
+*       - ListViewVirtual --> ScrollBar
 *       - ColorPicker   --> ColorPanel, ColorBarHue
 *       - MessageBox    --> Window, Label, Button
 *       - TextInputBox  --> Window, Label, TextBox, Button
 *
 *   It also provides a set of functions for styling the controls based on its properties (size, color).
 *
+*   Controls can draw directly (default) or record their drawing into a per-frame draw list: calling
+*   GuiBeginFrame()/GuiEndFrame() around controls records GuiDrawCommand entries (rectangles, gradients,
+*   triangles, text, icons, textures) that are submitted to the backend on GuiEndFrame().
+*   Recorded commands could be retrieved with GuiGetDrawCommands() to cull, sort or batch them.
+*   GuiNeedsRedraw() compares current frame commands signature with last drawn frame, so idle
+*   frames (nothing changed) could skip GuiEndFrame() and rendering. GuiGetDirtyRects() reports
+*   the areas changed since last drawn frame, to redraw only those ones (scissored).
+*
+*   All gui state lives in a GuiContext. A default context is used unless a new one is created with
+*   GuiCreateContext() and set with GuiSetContext(); current context is per-thread, so independent
+*   gui instances could be built concurrently (i.e. recording draw lists on worker threads).
+*   Text helpers (GuiTextSplit(), GuiIconText() and standalone TextFormat(), TextSplit()) return
+*   memory from a per-context scratch arena, reset once per frame by GuiEndFrame(), GuiUpdateHitTest()
+*   or GuiResetScratch(), so results stay valid for the whole frame (check GuiGetScratchStats()).
+*   Calling GuiUpdateHitTest() once per frame enables hit testing: controls bounds are registered
+*   every frame and only the topmost control under mouse reacts, so overlapped controls (i.e.
+*   panels below a GuiWindowBox()) do not get focused or clicked through.
+*   Controls keeping state between frames (i.e. text edit cursor blinking) store it on a per-context
+*   state table, keyed by control id: ids hash the control data pointer (or a string) with current
+*   id scope, pushed with GuiPushId()/GuiPushIdPtr(), so they do not depend on control bounds.
+*   Controls drawn between GuiBeginClip()/GuiEndClip() (i.e. GuiScrollPanel() content) are scissored
+*   to the clip area and skip input and drawing when fully outside it, so large scrolled content only
+*   costs its visible controls. Clip areas can be nested.
+*
 *   CONFIGURATION:
 *
 *   #define RAYGUI_IMPLEMENTATION
@@ -62,11 +87,21 @@
 *       Avoid raylib.h header inclusion in this file. Data types defined on raylib are defined
 *       internally in the library and input management and drawing functions must be provided by
 *       the user (check library implementation for further details).
+*       A headless software rasterizer backend is provided: examples/standalone/software_backend.h
 *
 *   #define RAYGUI_SUPPORT_ICONS
 *       Includes riconsdata.h header defining a set of 128 icons (binary format) to be used on
 *       multiple controls and following raygui styles
 *
+*   #define RAYGUI_THREAD_LOCAL
+*       Thread-local storage specifier used for the current gui context (one per thread),
+*       automatically defined for C11/C++11 and common compilers, can be externally provided
+*
+*   #define RAYGUI_STYLE_DEFAULT_ROWS(ROW)
+*       Default style compiled as constant data, one ROW(...) per control with its 24 property values
+*       (check default definition), contexts start with it and GuiLoadStyleDefault() restores it.
+*       By default, raygui LIGHT style is used
+*
 *
 *   VERSIONS HISTORY:
 *       2.7 (20-Feb-2020) Added possible tooltips API
@@ -156,8 +191,8 @@
 #endif
 
 
-#if !defined(RAYGUI_MALLOC) && !defined(RAYGUI_CALLOC) && !defined(RAYGUI_FREE)
-    #include <stdlib.h>                 // Required for: malloc(), calloc(), free()
+#if !defined(RAYGUI_MALLOC) && !defined(RAYGUI_CALLOC) && !defined(RAYGUI_REALLOC) && !defined(RAYGUI_FREE)
+    #include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free()
 #endif
 
 // Allow custom memory allocators
@@ -167,6 +202,9 @@
 #ifndef RAYGUI_CALLOC
     #define RAYGUI_CALLOC(n,sz)     calloc(n,sz)
 #endif
+#ifndef RAYGUI_REALLOC
+    #define RAYGUI_REALLOC(p,sz)    realloc(p,sz)
+#endif
 #ifndef RAYGUI_FREE
     #define RAYGUI_FREE(p)          free(p)
 #endif
@@ -177,9 +215,56 @@
 #define NUM_CONTROLS                    16      // Number of standard controls
 #define NUM_PROPS_DEFAULT               16      // Number of standard properties
 #define NUM_PROPS_EXTENDED               8      // Number of extended properties
+#define NUM_PROPS_COLORS                12      // Number of color properties (first standard properties)
 
 #define TEXTEDIT_CURSOR_BLINK_FRAMES    20      // Text edit controls cursor blink timming
 
+// Thread-local storage specifier, required for per-thread current context
+#if !defined(RAYGUI_THREAD_LOCAL)
+    #if defined(__cplusplus) && (__cplusplus >= 201103L)
+        #define RAYGUI_THREAD_LOCAL     thread_local
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+        #define RAYGUI_THREAD_LOCAL     _Thread_local
+    #elif defined(_MSC_VER)
+        #define RAYGUI_THREAD_LOCAL     __declspec(thread)
+    #elif defined(__GNUC__)
+        #define RAYGUI_THREAD_LOCAL     __thread
+    #else
+        #define RAYGUI_THREAD_LOCAL     // WARNING: No thread-local support, current context shared by all threads
+    #endif
+#endif
+
+#if !defined(TEXTMEASURE_CACHE_SIZE)
+    #define TEXTMEASURE_CACHE_SIZE  1024        // Text measurement cache entries (must be power of 2)
+#endif
+
+#if !defined(DIRTYRECTS_MAX_COUNT)
+    #define DIRTYRECTS_MAX_COUNT      32        // Maximum dirty rectangles reported, more changes are merged
+#endif
+
+#if !defined(IDSTACK_MAX_SIZE)
+    #define IDSTACK_MAX_SIZE          32        // Maximum id scopes pushed, deeper scopes are not considered
+#endif
+
+#if !defined(CLIPSTACK_MAX_SIZE)
+    #define CLIPSTACK_MAX_SIZE        16        // Maximum clip areas pushed, deeper clips are not considered
+#endif
+
+#if !defined(STATEDATA_SIZE)
+    #define STATEDATA_SIZE            32        // Control state data size in bytes (GuiGetStateData())
+#endif
+
+#if !defined(DRAWLIST_TEXT_BLOCK_SIZE)
+    #define DRAWLIST_TEXT_BLOCK_SIZE  4096      // Draw-list text storage block size (bigger texts get their own block)
+#endif
+
+#if !defined(SCRATCH_ARENA_BLOCK_SIZE)
+    #define SCRATCH_ARENA_BLOCK_SIZE 16384      // Scratch arena block size, arena grows by blocks (bigger requests get their own block)
+#endif
+#if !defined(SCRATCH_ARENA_MAX_SIZE)
+    #define SCRATCH_ARENA_MAX_SIZE    1048576   // Scratch arena maximum bytes between resets, reused from start when exceeded (no frame reset point)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 // NOTE: Some types are required for RAYGUI_STANDALONE usage
@@ -252,6 +337,55 @@ typedef struct GuiStyleProp {
     int propertyValue;
 } GuiStyleProp;
 
+// Gui draw command type
+typedef enum {
+    GUI_DRAWCMD_NONE = 0,           // Empty command, skipped on drawing (useful to cull commands)
+    GUI_DRAWCMD_RECTANGLE,          // Filled rectangle
+    GUI_DRAWCMD_GRADIENT,           // Rectangle with 4 vertex colors gradient
+    GUI_DRAWCMD_TRIANGLE,           // Filled triangle
+    GUI_DRAWCMD_TEXT,               // Glyph run, one line of text
+    GUI_DRAWCMD_TEXT_REC,           // Glyph run, text limited by a rectangle (and optional selection)
+    GUI_DRAWCMD_ICON,               // Gui icon
+    GUI_DRAWCMD_TEXTURE,            // Texture piece
+    GUI_DRAWCMD_SCISSOR,            // Begin scissor mode, drawing limited to rectangle (GuiBeginClip())
+    GUI_DRAWCMD_SCISSOR_END,        // End scissor mode, rectangle is the area that was clipped (GuiEndClip())
+} GuiDrawCommandType;
+
+// Gui draw command, recorded by controls in draw-list mode
+// NOTE: Text commands are drawn with current gui font
+typedef struct GuiDrawCommand {
+    int type;                       // Command type (GuiDrawCommandType)
+    Rectangle rec;                  // Command bounds: rectangle, gradient, text area, icon or texture destination
+    Color color[4];                 // Command colors, only GUI_DRAWCMD_GRADIENT uses all of them (vertex colors)
+    union {
+        Vector2 vertex[3];          // GUI_DRAWCMD_TRIANGLE: Triangle vertices
+        struct {
+            const char *text;       // Text to draw (copied into frame text storage)
+            float fontSize;         // Text font size
+            float spacing;          // Text spacing
+            int wordWrap;           // GUI_DRAWCMD_TEXT_REC: Text word wrap
+            int selectStart;        // GUI_DRAWCMD_TEXT_REC: Selection start (color[1]: text, color[2]: background)
+            int selectLength;       // GUI_DRAWCMD_TEXT_REC: Selection length
+        } text;
+        struct {
+            int iconId;             // Icon id
+            int pixelSize;          // Icon pixel size
+        } icon;
+        struct {
+            Texture2D texture;      // Texture to draw
+            Rectangle source;       // Texture source rectangle
+        } texture;
+    } data;
+} GuiDrawCommand;
+
+// Gui context, holds all the gui state (opaque type)
+// NOTE: Every thread has its own current context, by default a global context shared by all threads
+typedef struct GuiContext GuiContext;
+
+// Gui list item callback, returns item text for a given item index
+// NOTE: Used by GuiListViewVirtual(), only called for visible items
+typedef const char *(*GuiListItemCallback)(long long index, void *userData);
+
 // Gui control state
 typedef enum {
     GUI_STATE_NORMAL = 0,
@@ -316,6 +450,8 @@ typedef enum {
     TEXT_SPACING,
     LINE_COLOR,
     BACKGROUND_COLOR,
+    LAYOUT_PADDING,         // Layout padding around cells (check gui_layout.h)
+    LAYOUT_SPACING,         // Layout spacing between cells (check gui_layout.h)
 } GuiDefaultProperty;
 
 // Label
@@ -413,6 +549,12 @@ typedef enum {
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 
+// Context management functions
+RAYGUIDEF GuiContext *GuiCreateContext(void);                           // Create a new gui context (default style, not set as current)
+RAYGUIDEF void GuiDestroyContext(GuiContext *ctx);                      // Destroy a gui context (default context can not be destroyed)
+RAYGUIDEF void GuiSetContext(GuiContext *ctx);                          // Set current gui context for calling thread (NULL: default context)
+RAYGUIDEF GuiContext *GuiGetContext(void);                              // Get current gui context for calling thread
+
 // State modification functions
 RAYGUIDEF void GuiEnable(void);                                         // Enable gui controls (global state)
 RAYGUIDEF void GuiDisable(void);                                        // Disable gui controls (global state)
@@ -429,6 +571,8 @@ RAYGUIDEF Font GuiGetFont(void);                                        // Get g
 // Style set/get functions
 RAYGUIDEF void GuiSetStyle(int control, int property, int value);       // Set one style property
 RAYGUIDEF int GuiGetStyle(int control, int property);                   // Get one style property
+RAYGUIDEF void GuiPushStyle(void);                                      // Push style scope, GuiSetStyle() changes are recorded until GuiPopStyle()
+RAYGUIDEF void GuiPopStyle(void);                                       // Pop style scope, style properties changed since GuiPushStyle() are restored
 
 // Tooltips set functions
 RAYGUIDEF void GuiEnableTooltip(void);                                  // Enable gui tooltips
@@ -436,6 +580,32 @@ RAYGUIDEF void GuiDisableTooltip(void);                                 // Disab
 RAYGUIDEF void GuiSetTooltip(const char *tooltip);                      // Set current tooltip for display
 RAYGUIDEF void GuiClearTooltip(void);                                   // Clear any tooltip registered
 
+// Hit testing functions
+RAYGUIDEF void GuiUpdateHitTest(void);                                  // Update hit testing (once per frame), only topmost control under mouse reacts
+
+// Control ids and state functions
+RAYGUIDEF void GuiPushId(const char *str);                              // Push id scope hashed from string (i.e. window or form name)
+RAYGUIDEF void GuiPushIdPtr(const void *ptr);                           // Push id scope hashed from pointer (i.e. list element data)
+RAYGUIDEF void GuiPopId(void);                                          // Pop id scope
+RAYGUIDEF unsigned int GuiGetId(const char *str);                       // Get control id hashed from string on current id scope
+RAYGUIDEF unsigned int GuiGetIdPtr(const void *ptr);                    // Get control id hashed from pointer on current id scope
+RAYGUIDEF void *GuiGetStateData(unsigned int id);                       // Get control state data (STATEDATA_SIZE bytes, zeroed on first use), valid until next call
+RAYGUIDEF void GuiRemoveStateData(unsigned int id);                     // Remove control state data
+
+// Clipping functions
+RAYGUIDEF void GuiBeginClip(Rectangle bounds);                          // Begin clip area (nested in current one), controls fully outside it are skipped
+RAYGUIDEF void GuiEndClip(void);                                        // End clip area, parent clip area is restored
+
+// Draw-list mode functions
+RAYGUIDEF void GuiBeginFrame(void);                                     // Begin gui frame, controls draw commands are recorded into frame draw list
+RAYGUIDEF void GuiEndFrame(void);                                       // End gui frame, recorded draw commands are submitted to backend
+RAYGUIDEF GuiDrawCommand *GuiGetDrawCommands(int *count);               // Get current frame draw commands (could be modified before GuiEndFrame())
+RAYGUIDEF void GuiDrawCommands(const GuiDrawCommand *commands, int count);  // Draw a list of commands using backend drawing functions
+RAYGUIDEF bool GuiNeedsRedraw(void);                                    // Check if current frame draw list differs from last drawn frame
+RAYGUIDEF Rectangle *GuiGetDirtyRects(int *count);                      // Get screen areas changed since last drawn frame (partial redraw)
+RAYGUIDEF void GuiGetScratchStats(int *capacity, int *highWater);       // Get scratch arena capacity and high-water mark (bytes)
+RAYGUIDEF void GuiResetScratch(void);                                   // Reset scratch arena, text helpers results are released (once per frame)
+
 // Container/separator controls, useful for controls organization
 RAYGUIDEF bool GuiWindowBox(Rectangle bounds, const char *title);                                       // Window Box control, shows a window that can be closed
 RAYGUIDEF void GuiGroupBox(Rectangle bounds, const char *text);                                         // Group Box control with text name
@@ -469,6 +639,7 @@ RAYGUIDEF Vector2 GuiGrid(Rectangle bounds, float spacing, int subdivs);
 // Advance controls set
 RAYGUIDEF int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int active);            // List View control, returns selected list item index
 RAYGUIDEF int GuiListViewEx(Rectangle bounds, const char **text, int count, int *focus, int *scrollIndex, int active,bool dontUseScrollbar);      // List View with extended parameters
+RAYGUIDEF long long GuiListViewVirtual(Rectangle bounds, long long count, GuiListItemCallback getItem, void *userData, long long *focus, long long *scrollIndex, long long active);  // List View with items requested on demand
 RAYGUIDEF int GuiMessageBox(Rectangle bounds, const char *title, const char *message, const char *buttons);                 // Message Box control, displays a message
 RAYGUIDEF int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, const char *buttons, char *text);   // Text Input Box control, ask for text
 RAYGUIDEF Color GuiColorPicker(Rectangle bounds, Color color);                                          // Color Picker control (multiple color controls)
@@ -478,6 +649,7 @@ RAYGUIDEF float GuiColorBarHue(Rectangle bounds, float value);
 
 // Styles loading functions
 RAYGUIDEF void GuiLoadStyle(const char *fileName);              // Load style file (.rgs)
+RAYGUIDEF void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize);    // Load style from memory (binary .rgs file data)
 RAYGUIDEF void GuiLoadStyleDefault(void);                       // Load style default over global style
 
 /*
@@ -510,15 +682,17 @@ RAYGUIDEF bool GuiCheckIconPixel(int iconId, int x, int y);     // Check icon pi
 *
 ************************************************************************************/
 
+#if defined(RAYGUI_IMPLEMENTATION)
+
 #if defined(RAYGUI_SUPPORT_ICONS)
     #define RICONS_IMPLEMENTATION
     #include "ricons.h"         // Required for: raygui icons data
 #endif
 
-#if defined(RAYGUI_IMPLEMENTATION)
-
-#include <stdio.h>              // Required for: FILE, fopen(), fclose(), fprintf(), feof(), fscanf(), vsprintf()
-#include <string.h>             // Required for: strlen() on GuiTextBox()
+#include <stdio.h>              // Required for: FILE, fopen(), fclose(), fprintf(), feof(), fscanf(), snprintf(), vsnprintf()
+#include <string.h>             // Required for: strlen() on GuiTextBox(), memcpy(), memset()
+#include <stdlib.h>             // Required for: qsort(), strtol(), strtoul()
+#include <limits.h>             // Required for: INT_MAX
 
 #if defined(RAYGUI_STANDALONE)
     #include <stdarg.h>         // Required for: va_list, va_start(), vfprintf(), va_end()
@@ -533,7 +707,10 @@ RAYGUIDEF bool GuiCheckIconPixel(int iconId, int x, int y);     // Check icon pi
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#if defined(RAYGUI_SUPPORT_ICONS)
+    #define RICON_ATLAS_COLUMNS     16      // Icons atlas columns (rows depend on RICON_MAX_ICONS)
+    #define RICON_ATLAS_ROWS        ((RICON_MAX_ICONS + RICON_ATLAS_COLUMNS - 1)/RICON_ATLAS_COLUMNS)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -541,25 +718,302 @@ RAYGUIDEF bool GuiCheckIconPixel(int iconId, int x, int y);     // Check icon pi
 // Gui control property style color element
 typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 
+// Topmost control resolution state, reset every frame by GuiUpdateHitTest()
+typedef enum {
+    GUI_HIT_UNRESOLVED = 0,         // Topmost control not resolved yet (no control checked under mouse)
+    GUI_HIT_BLOCKED,                // Controls under mouse are overlapped until topmost bounds are registered
+    GUI_HIT_PASSED                  // Topmost bounds registered (or none found), controls under mouse react
+} GuiHitTopmostState;
+
+// Draw-list text storage block
+// NOTE: Blocks are never reallocated, recorded text pointers remain valid until next frame
+typedef struct GuiTextBlock {
+    char *data;                     // Block text data
+    int size;                       // Block data size in bytes
+    int used;                       // Block data used in bytes
+    struct GuiTextBlock *next;      // Next block on the list
+} GuiTextBlock;
+
+// Scratch arena memory block
+// NOTE: Blocks are kept between frames, arena only allocates while growing over its high-water mark
+typedef struct GuiScratchBlock {
+    unsigned char *data;            // Block data
+    int size;                       // Block data size in bytes
+    int used;                       // Block data used in bytes
+    struct GuiScratchBlock *next;   // Next block on the list
+} GuiScratchBlock;
+
+// Drawn command entry, used to compare frames
+typedef struct GuiDrawnCommand {
+    unsigned int hash;              // Command visual hash
+    Rectangle rec;                  // Command bounds
+} GuiDrawnCommand;
+
+// Text measurement cache entry
+// NOTE: Entry is keyed by text content hash and length plus font size and spacing,
+// gui font is not part of the key, cache is invalidated on GuiSetFont()
+typedef struct GuiTextMeasure {
+    unsigned int hash;              // Text content hash (FNV-1a)
+    int length;                     // Text length in bytes
+    float fontSize;                 // Text font size
+    float spacing;                  // Text spacing
+    Vector2 size;                   // Text measured size
+    unsigned int generation;        // Cache generation, entries from previous generations are invalid
+} GuiTextMeasure;
+
+// Style property change, recorded by GuiSetStyle() inside a style scope
+typedef struct GuiStyleChange {
+    int index;                      // Style property index on style array
+    unsigned int value;             // Style property value before change
+    unsigned int scope;             // Scope that recorded the property before this change
+} GuiStyleChange;
+
+// Style scope, pushed by GuiPushStyle()
+typedef struct GuiStyleScope {
+    int changesStart;               // First style change recorded on this scope
+    unsigned int id;                // Scope id, unique per GuiPushStyle()
+} GuiStyleScope;
+
+// Control state table entry
+typedef struct GuiStateEntry {
+    unsigned int id;                // Control id (0 for empty entries)
+    union {
+        unsigned char bytes[STATEDATA_SIZE];
+        long long alignInt;         // Data is aligned for any control state type
+        double alignFloat;
+        void *alignPtr;
+    } data;                         // Control state data
+} GuiStateEntry;
+
+// Gui context
+// NOTE: All gui state lives in the context, so independent gui instances can be
+// used concurrently (one current context per thread)
+struct GuiContext {
+    GuiControlState state;          // Gui global state
+    Font font;                      // Gui current font (WARNING: highly coupled to raylib)
+    bool locked;                    // Gui lock state (no inputs processed)
+    float alpha;                    // Gui element transpacency on drawing
+
+    // Gui style array
+    // NOTE: In raygui we manage a single int array with all the possible style properties.
+    // When a new style is loaded, it loads over the context style... but default gui style
+    // could always be recovered with GuiLoadStyleDefault()
+    unsigned int style[NUM_CONTROLS*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED)];
+
+    // Style colors resolved for drawing: Fade(GetColor(style), alpha) for every color property,
+    // updated on GuiSetStyle() and GuiFade(), controls read them with GuiGetStyleColor()
+    Color styleColors[NUM_CONTROLS*NUM_PROPS_COLORS];
+
+    // Tooltips required variables
+    const char *tooltip;            // Gui tooltip currently active (user provided)
+    bool tooltipEnabled;            // Gui tooltips enabled
+
+    // Text measurement cache required variables
+    GuiTextMeasure textMeasureCache[TEXTMEASURE_CACHE_SIZE];
+    unsigned int textMeasureGeneration;     // Current cache generation, increased on invalidation
+
+    // Draw-list mode required variables
+    bool drawListActive;            // Draw-list mode active (between GuiBeginFrame() and GuiEndFrame())
+    GuiDrawCommand *drawCommands;   // Draw commands recorded on current frame
+    int drawCommandsCount;          // Draw commands recorded count
+    int drawCommandsCapacity;       // Draw commands array capacity (grows as required)
+    GuiTextBlock *drawTextBlocks;   // Text storage for recorded text commands
+    GuiDrawCommand drawCommandDiscarded;    // Command recorded on allocation failure
+    unsigned int drawnSignature;    // Signature of last frame submitted with GuiEndFrame()
+    bool drawnSignatureValid;       // Some frame has been submitted with GuiEndFrame()
+
+    // Dirty rectangles required variables
+    GuiDrawnCommand *drawnCommands; // Last drawn frame commands (sorted by hash)
+    int drawnCommandsCount;         // Last drawn frame commands count
+    GuiDrawnCommand *frameCommands; // Current frame commands (sorted by hash), computed by GuiGetDirtyRects()
+    int drawnCommandsCapacity;      // Drawn/frame commands arrays capacity
+    Rectangle dirtyRects[DIRTYRECTS_MAX_COUNT];     // Dirty rectangles returned by GuiGetDirtyRects()
+
+    // Controls required variables
+    void *textBoxExt;               // Extended text box state (gui_textbox_extended.h), allocated on demand
+
+    // Control ids and state table required variables
+    // NOTE: State table is open-addressed (linear probing), its capacity is a power of 2
+    unsigned int idStack[IDSTACK_MAX_SIZE];     // Id scopes stack (scope seeds)
+    int idStackCount;               // Id scopes pushed count
+    GuiStateEntry *stateEntries;    // Control state table entries
+    int stateEntriesCount;          // Control state table entries used
+    int stateEntriesCapacity;       // Control state table capacity (grows as required)
+    GuiStateEntry stateDiscarded;   // Control state returned on allocation failure
+
+    // Style stack required variables
+    // NOTE: Every property is recorded once per scope (first change), so GuiPopStyle() is O(changes)
+    GuiStyleChange *styleChanges;   // Style changes recorded on all pushed scopes
+    int styleChangesCount;          // Style changes recorded count
+    int styleChangesCapacity;       // Style changes array capacity (grows as required)
+    GuiStyleScope *styleScopes;     // Style scopes stack
+    int styleScopesCount;           // Style scopes pushed count
+    int styleScopesCapacity;        // Style scopes array capacity (grows as required)
+    unsigned int styleScopeId;      // Last style scope id assigned
+    unsigned int styleRecorded[NUM_CONTROLS*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED)];  // Scope that last recorded every property
+
+    // Hit testing required variables
+    // NOTE: Topmost control is resolved against previous frame bounds (controls drawn later are not known yet)
+    bool hitTestActive;             // Hit testing active (GuiUpdateHitTest() called)
+    Rectangle *hitRects;            // Controls bounds registered on current frame (drawing order)
+    int hitRectsCount;              // Controls bounds registered count
+    int hitRectsCapacity;           // Controls bounds array capacity (grows as required)
+    bool hitRectsDiscarded;         // Some bounds could not be registered (allocation failure)
+    Rectangle *hitRectsPrev;        // Controls bounds registered on previous frame
+    int hitRectsPrevCount;          // Previous frame controls bounds count
+    int hitRectsPrevCapacity;       // Previous frame controls bounds array capacity
+    int hitTopmostState;            // Topmost control resolution state (GuiHitTopmostState)
+    Rectangle hitTopmost;           // Topmost previous frame bounds under mouse
+
+    // Clip stack required variables
+    Rectangle clipStack[CLIPSTACK_MAX_SIZE];    // Clip areas stack, every area is already intersected with its parent
+    int clipStackCount;             // Clip areas pushed count
+
+    // Scratch arena required variables
+    // NOTE: Text functions (GuiTextSplit(), GuiIconText(), TextFormat(), TextSplit()) results are allocated from it
+    GuiScratchBlock *scratchBlocks;     // Scratch arena blocks list
+    GuiScratchBlock *scratchCurrent;    // Scratch arena block currently allocating (previous ones are full)
+    int scratchUsed;                    // Scratch arena bytes used since last reset
+    int scratchHighWater;               // Scratch arena maximum bytes used between resets
+
+#if defined(RAYGUI_SUPPORT_ICONS)
+    unsigned int iconData[RICON_DATA_ELEMENTS];                 // GuiGetIconData() icon data
+#endif
+};
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static GuiControlState guiState = GUI_STATE_NORMAL;
-
-static Font guiFont = { 0 };            // Gui current font (WARNING: highly coupled to raylib)
-static bool guiLocked = false;          // Gui lock state (no inputs processed)
-static float guiAlpha = 1.0f;           // Gui element transpacency on drawing
+// Default style, one row per control: NUM_PROPS_DEFAULT standard properties (first NUM_PROPS_COLORS ones are colors)
+// and NUM_PROPS_EXTENDED extended properties, with DEFAULT standard properties already propagated to all controls
+// NOTE: Style is constant data, contexts start with it so there is no lazy style initialization
+#if !defined(RAYGUI_STYLE_DEFAULT_ROWS)
+#define RAYGUI_STYLE_DEFAULT_ROWS(ROW) \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 10, 1, 0x90abb5ff, 0xf5f5f5ff, 0, 0, 0, 0) /* DEFAULT */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) /* LABEL */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0) /* BUTTON */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0) /* TOGGLE */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 5, 1, 0, 15, 1, 0, 0, 0, 0, 0, 0) /* SLIDER */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0) /* PROGRESSBAR */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 5, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0) /* CHECKBOX */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 30, 2, 0, 0, 0, 0, 0, 0) /* COMBOBOX */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 16, 2, 0, 0, 0, 0, 0, 0) /* DROPDOWNBOX */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 5, 0, 0, 4, 5, 0xf0fffeff, 0x839affe0, 0, 0, 0, 0) /* TEXTBOX */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) /* VALUEBOX */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 4, 0, 0, 20, 2, 0, 0, 0, 0, 0, 0) /* SPINNER */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 30, 2, 10, 1, 0, 0, 0, 0) /* LISTVIEW */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 0, 1, 0, 6, 20, 10, 6, 2, 0, 0, 0) /* COLORPICKER */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 0, 0, 1, 0, 6, 0, 0, 16, 0, 10, 0, 0) /* SCROLLBAR */ \
+    ROW(0x838383ff, 0xc9c9c9ff, 0x686868ff, 0x5bb2d9ff, 0xc9effeff, 0x6c9bbcff, 0x0492c7ff, 0x97e8ffff, 0x368bafff, 0xb5c1c2ff, 0xe6e9e9ff, 0xaeb7b8ff, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) /* STATUSBAR */
+#endif
 
-// Global gui style array (allocated on heap by default)
-// NOTE: In raygui we manage a single int array with all the possible style properties.
-// When a new style is loaded, it loads over the global style... but default gui style
-// could always be recovered with GuiLoadStyleDefault()
-static unsigned int guiStyle[NUM_CONTROLS*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED)] = { 0 };
-static bool guiStyleLoaded = false;     // Style loaded flag for lazy style initialization
+#define GUI_STYLE_ROW_VALUES(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, p12, p13, p14, p15, e0, e1, e2, e3, e4, e5, e6, e7) \
+    c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, p12, p13, p14, p15, e0, e1, e2, e3, e4, e5, e6, e7,
+#define GUI_STYLE_ROW_COLORS(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, p12, p13, p14, p15, e0, e1, e2, e3, e4, e5, e6, e7) \
+    GUI_STYLE_COLOR(c0), GUI_STYLE_COLOR(c1), GUI_STYLE_COLOR(c2), GUI_STYLE_COLOR(c3), GUI_STYLE_COLOR(c4), GUI_STYLE_COLOR(c5), GUI_STYLE_COLOR(c6), GUI_STYLE_COLOR(c7), GUI_STYLE_COLOR(c8), GUI_STYLE_COLOR(c9), GUI_STYLE_COLOR(c10), GUI_STYLE_COLOR(c11),
+
+// Style color resolved with gui alpha 1.0f, same as Fade(GetColor(hexValue), 1.0f)
+#define GUI_STYLE_COLOR(hexValue) { (unsigned char)(((hexValue) >> 24) & 0xff), (unsigned char)(((hexValue) >> 16) & 0xff), (unsigned char)(((hexValue) >> 8) & 0xff), 255 }
+
+static const unsigned int guiStyleDefault[NUM_CONTROLS*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED)] = { RAYGUI_STYLE_DEFAULT_ROWS(GUI_STYLE_ROW_VALUES) };
+static const Color guiStyleColorsDefault[NUM_CONTROLS*NUM_PROPS_COLORS] = { RAYGUI_STYLE_DEFAULT_ROWS(GUI_STYLE_ROW_COLORS) };
+
+// Default gui context, current context for all threads until GuiSetContext()
+// NOTE: All members are listed in declaration order, keep in sync with GuiContext and GuiCreateContext()
+static GuiContext guiContextDefault = {
+    GUI_STATE_NORMAL,           // state
+    { 0 },                      // font
+    false,                      // locked
+    1.0f,                       // alpha
+    { RAYGUI_STYLE_DEFAULT_ROWS(GUI_STYLE_ROW_VALUES) },    // style
+    { RAYGUI_STYLE_DEFAULT_ROWS(GUI_STYLE_ROW_COLORS) },    // styleColors
+    NULL,                       // tooltip
+    true,                       // tooltipEnabled
+    { { 0 } },                  // textMeasureCache
+    1,                          // textMeasureGeneration
+    false,                      // drawListActive
+    NULL,                       // drawCommands
+    0,                          // drawCommandsCount
+    0,                          // drawCommandsCapacity
+    NULL,                       // drawTextBlocks
+    { 0 },                      // drawCommandDiscarded
+    0,                          // drawnSignature
+    false,                      // drawnSignatureValid
+    NULL,                       // drawnCommands
+    0,                          // drawnCommandsCount
+    NULL,                       // frameCommands
+    0,                          // drawnCommandsCapacity
+    { { 0, 0, 0, 0 } },         // dirtyRects
+    NULL,                       // textBoxExt
+    { 0 },                      // idStack
+    0,                          // idStackCount
+    NULL,                       // stateEntries
+    0,                          // stateEntriesCount
+    0,                          // stateEntriesCapacity
+    { 0 },                      // stateDiscarded
+    NULL,                       // styleChanges
+    0,                          // styleChangesCount
+    0,                          // styleChangesCapacity
+    NULL,                       // styleScopes
+    0,                          // styleScopesCount
+    0,                          // styleScopesCapacity
+    0,                          // styleScopeId
+    { 0 },                      // styleRecorded
+    false,                      // hitTestActive
+    NULL,                       // hitRects
+    0,                          // hitRectsCount
+    0,                          // hitRectsCapacity
+    false,                      // hitRectsDiscarded
+    NULL,                       // hitRectsPrev
+    0,                          // hitRectsPrevCount
+    0,                          // hitRectsPrevCapacity
+    0,                          // hitTopmostState
+    { 0, 0, 0, 0 },             // hitTopmost
+    { { 0, 0, 0, 0 } },         // clipStack
+    0,                          // clipStackCount
+    NULL,                       // scratchBlocks
+    NULL,                       // scratchCurrent
+    0,                          // scratchUsed
+    0,                          // scratchHighWater
+#if defined(RAYGUI_SUPPORT_ICONS)
+    { 0 },                      // iconData
+#endif
+};
+
+static RAYGUI_THREAD_LOCAL GuiContext *guiCtx = &guiContextDefault;    // Current gui context (per thread)
+
+// Current context variables access
+// NOTE: Named as plain variables, custom controls (defined in the implementation
+// translation unit) keep using guiState, guiFont, guiLocked and guiAlpha
+#define guiState                    (guiCtx->state)
+#define guiFont                     (guiCtx->font)
+#define guiLocked                   (guiCtx->locked)
+#define guiAlpha                    (guiCtx->alpha)
+#define guiStyle                    (guiCtx->style)
+#define guiStyleColors              (guiCtx->styleColors)
+#define guiTooltip                  (guiCtx->tooltip)
+#define guiTooltipEnabled           (guiCtx->tooltipEnabled)
+#define guiTextMeasureCache         (guiCtx->textMeasureCache)
+#define guiTextMeasureGeneration    (guiCtx->textMeasureGeneration)
+#define guiDrawListActive           (guiCtx->drawListActive)
+#define guiDrawCommands             (guiCtx->drawCommands)
+#define guiDrawCommandsCount        (guiCtx->drawCommandsCount)
+#define guiDrawCommandsCapacity     (guiCtx->drawCommandsCapacity)
+#define guiDrawTextBlocks           (guiCtx->drawTextBlocks)
 
-// Tooltips required variables
-static const char *guiTooltip = NULL;   // Gui tooltip currently active (user provided)
-static bool guiTooltipEnabled = true;   // Gui tooltips enabled
+#if defined(RAYGUI_SUPPORT_ICONS)
+// Icons atlas required variables
+// NOTE: Icons are baked (white pixels, tinted on drawing) on first GuiDrawIcon() call,
+// icons modified later are marked and only those ones are re-baked.
+// Icons data and atlas are shared by all contexts, modify icons from a single thread
+static bool guiIconsDirty[RICON_MAX_ICONS] = { 0 };  // Icons modified since last atlas bake
+static bool guiIconsAtlasDirty = false;             // Some icon requires re-baking
+static unsigned int guiIconsVersion = 0;            // Icons modifications counter, part of frame signature
+#if !defined(RAYGUI_STANDALONE)
+static unsigned char *guiIconsAtlasData = NULL;     // Icons atlas pixel data (RGBA), kept for partial re-bakes
+static Texture2D guiIconsAtlas = { 0 };             // Icons atlas texture
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
@@ -599,12 +1053,15 @@ static void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);
 static void DrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint);       // -- GuiImageButtonEx()
 
 static void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint); // -- GuiTextBoxMulti()
+
+static void BeginScissorMode(int x, int y, int width, int height);      // -- GuiBeginClip()
+static void EndScissorMode(void);                                       // -- GuiEndClip()
 //-------------------------------------------------------------------------------
 
 // Text required functions
 //-------------------------------------------------------------------------------
 static Font GetFontDefault(void);                                                                                  // -- GuiLoadStyleDefault()
-static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);                          // -- GetTextWidth(), GuiTextBoxMulti()
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);                          // -- GuiMeasureText()
 static void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);  // -- GuiDrawText()
 
 static Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount);  // -- GuiLoadStyle()
@@ -615,7 +1072,7 @@ static const char *GetDirectoryPath(const char *filePath);  // -- GuiLoadStyle()
 // raylib functions already implemented in raygui
 //-------------------------------------------------------------------------------
 static Color GetColor(int hexValue);                // Returns a Color struct from hexadecimal value
-static int ColorToInt(Color color);                 // Returns hexadecimal value for a Color
+static inline int ColorToInt(Color color);          // Returns hexadecimal value for a Color
 static Color Fade(Color color, float alpha);        // Color fade-in or fade-out, alpha goes from 0.0f to 1.0f
 static bool CheckCollisionPointRec(Vector2 point, Rectangle rec);   // Check if point is inside rectangle
 static const char *TextFormat(const char *text, ...);               // Formatting of text with variables to 'embed'
@@ -635,12 +1092,118 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
 static Vector3 ConvertHSVtoRGB(Vector3 hsv);    // Convert color data from HSV to RGB
 static Vector3 ConvertRGBtoHSV(Vector3 rgb);    // Convert color data from RGB to HSV
 
+// Gui drawing functions, draw directly or record commands in draw-list mode
+// NOTE: All controls drawing must go through them
+static GuiDrawCommand *GuiPushDrawCommand(int type, Rectangle rec, Color color);   // Add new command to frame draw list
+static unsigned int GuiHashDrawCommand(const GuiDrawCommand *cmd);                  // Compute draw command visual hash
+static unsigned int GuiHashDrawCommands(const GuiDrawCommand *commands, int count, GuiDrawnCommand *drawn);   // Compute draw commands list signature
+static int GuiAddDirtyRect(Rectangle *rects, int count, Rectangle rec);            // Add dirty rectangle merging overlapped (or adjacent) ones
+static bool GuiReserveDrawnCommands(int count);                                     // Reserve drawn/frame commands arrays
+static int GuiCompareDrawnCommands(const void *a, const void *b);                   // Compare drawn commands by hash, required by qsort()
+static const char *GuiPushDrawText(const char *text);                               // Copy text into frame text storage
+static void *GuiScratchAlloc(int size);                                             // Allocate memory from scratch arena
+static bool GuiCheckHitRec(Vector2 point, Rectangle bounds);                        // Register control bounds, check if point is over it and not overlapped
+static bool GuiCheckHitRecEx(Vector2 point, Rectangle bounds, bool container);      // Register control bounds, check if point is over it and not overlapped (container controls)
+static unsigned int GuiHashId(unsigned int seed, const void *data, int size);       // Compute control id hash (FNV-1a), 0 is never returned
+static bool GuiResizeStateTable(int capacity);                                       // Resize control state table, entries are rehashed
+static void *GuiFindStateData(unsigned int id);                                      // Find control state data, NULL if not available (no entry added)
+static Rectangle GuiClipRec(Rectangle rec);                                          // Get rectangle part inside current clip area
+static bool GuiIsClipped(Rectangle bounds);                                          // Check if bounds are fully outside current clip area
+static bool GuiIsClippedText(Rectangle bounds, const char *textLeft, const char *textRight, int padding);   // Check if bounds and side texts are fully outside current clip area
+static void GuiDrawScissor(Rectangle rec, bool end);                                 // Begin/end scissor mode, directly or recorded
+
+static Color GuiGetStyleColor(int control, int property);                           // Get style color property resolved for drawing (faded with gui alpha)
+static void GuiUpdateStyleColors(void);                                             // Resolve all style colors for drawing
+static void GuiRecordStyle(int index);                                              // Record style property previous value on current style scope
+
+static void GuiSetStyleLoaded(int control, int property, unsigned int value);       // Set style property value loaded from style data
+static void GuiLoadStyleText(const char *text, const char *fileName);               // Load style from text style data (.rgs text file)
+static int GuiLoadStyleProperties(const unsigned char *fileData, int dataSize);     // Load style properties from binary style data, font data is not loaded
+static bool GuiReadStyleData(void *dst, int size, const unsigned char *data, int dataSize, int *offset);   // Copy data block from style data
+
+static long long GuiScrollBarEx(Rectangle bounds, long long value, long long minValue, long long maxValue, long long step, int sliderSize);    // Scroll Bar control with 64-bit range
+static void GuiDrawListViewItem(Rectangle itemBounds, const char *text, GuiControlState state, bool selected, bool focused);              // Draw List View item
+
+#if defined(RAYGUI_SUPPORT_ICONS)
+static void GuiDrawIconPixels(int iconId, Vector2 position, int pixelSize, Color color);    // Draw icon pixel runs as rectangles
+#if !defined(RAYGUI_STANDALONE)
+static bool GuiUpdateIconsAtlas(void);                                              // Bake icons atlas, only modified icons are re-baked
+#endif
+#endif
+static void GuiDrawRectangle(int posX, int posY, int width, int height, Color color);
+static void GuiDrawRectangleRec(Rectangle rec, Color color);
+static void GuiDrawRectangleLinesEx(Rectangle rec, int lineThick, Color color);
+static void GuiDrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4);
+static void GuiDrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2);
+static void GuiDrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);
+static void GuiDrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint);
+static void GuiDrawTextEx(const char *text, Vector2 position, float fontSize, float spacing, Color tint);
+static void GuiDrawTextRec(const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint,
+                           int selectStart, int selectLength, Color selectTint, Color selectBackTint);
+
+// Measure text with gui font, measurements are cached
+// NOTE: Hashing the text is much cheaper than measuring it (glyphs decoding and lookup)
+static Vector2 GuiMeasureText(const char *text, float fontSize, float spacing)
+{
+    #define TEXTMEASURE_CACHE_PROBES    4
+
+    // Compute text hash (FNV-1a) and length in a single pass
+    unsigned int hash = 2166136261u;
+    int length = 0;
+
+    for (; text[length] != '\0'; length++)
+    {
+        hash ^= (unsigned char)text[length];
+        hash *= 16777619u;
+    }
+
+    GuiTextMeasure *entry = NULL;
+    unsigned int index = hash & (TEXTMEASURE_CACHE_SIZE - 1);
+
+    for (int i = 0; i < TEXTMEASURE_CACHE_PROBES; i++)
+    {
+        GuiTextMeasure *probe = &guiTextMeasureCache[(index + i) & (TEXTMEASURE_CACHE_SIZE - 1)];
+
+        if (probe->generation != guiTextMeasureGeneration)
+        {
+            // Empty (or invalidated) entry, use it if text is not found
+            if (entry == NULL) entry = probe;
+        }
+        else if ((probe->hash == hash) && (probe->length == length) && (probe->fontSize == fontSize) && (probe->spacing == spacing)) return probe->size;
+    }
+
+    // Cache miss: measure text and store it (replacing home entry if no empty one found)
+    if (entry == NULL) entry = &guiTextMeasureCache[index];
+
+    entry->hash = hash;
+    entry->length = length;
+    entry->fontSize = fontSize;
+    entry->spacing = spacing;
+    entry->size = MeasureTextEx(guiFont, text, fontSize, spacing);
+    entry->generation = guiTextMeasureGeneration;
+
+    return entry->size;
+}
+
+// Invalidate text measurement cache
+static void GuiInvalidateTextMeasure(void)
+{
+    guiTextMeasureGeneration++;
+
+    // On generation counter wrap around, old entries could become valid again
+    if (guiTextMeasureGeneration == 0)
+    {
+        memset(guiTextMeasureCache, 0, sizeof(guiTextMeasureCache));
+        guiTextMeasureGeneration = 1;
+    }
+}
+
 // Gui get text width using default font
 static int GetTextWidth(const char *text)       // TODO: GetTextSize()
 {
     Vector2 size = { 0 };
 
-    if ((text != NULL) && (text[0] != '\0')) size = MeasureTextEx(guiFont, text, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
+    if ((text != NULL) && (text[0] != '\0')) size = GuiMeasureText(text, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
 
     // TODO: Consider text icon width here???
 
@@ -773,7 +1336,7 @@ void GuiDrawText(const char *text, Rectangle bounds, int alignment, Color tint)
         }
 #endif
 
-        DrawTextEx(guiFont, text, position, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), tint);
+        GuiDrawTextEx(text, position, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), tint);
         //---------------------------------------------------------------------------------
     }
 }
@@ -786,11 +1349,11 @@ static void GuiDrawTooltip(Rectangle bounds)
     if (guiTooltipEnabled && (guiTooltip != NULL) && CheckCollisionPointRec(GetMousePosition(), bounds))
     {
         Vector2 mousePosition = GetMousePosition();
-        Vector2 textSize = MeasureTextEx(guiFont, guiTooltip, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
+        Vector2 textSize = GuiMeasureText(guiTooltip, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
         Rectangle tooltipBounds = { mousePosition.x, mousePosition.y, textSize.x + 20, textSize.y*2 };
         
-        DrawRectangleRec(tooltipBounds, Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), guiAlpha));
-        DrawRectangleLinesEx(tooltipBounds, 1, Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), guiAlpha));
+        GuiDrawRectangleRec(tooltipBounds, Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), guiAlpha));
+        GuiDrawRectangleLinesEx(tooltipBounds, 1, Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), guiAlpha));
         
         tooltipBounds.x += 10;
         GuiLabel(tooltipBounds, guiTooltip);
@@ -799,12 +1362,76 @@ static void GuiDrawTooltip(Rectangle bounds)
 
 // Split controls text into multiple strings
 // Also check for multiple columns (required by GuiToggleGroup())
- const char **GuiTextSplit(const char *text, int *count, int *textRow);
+ const char **GuiTextSplit(const char *text, int *count, int **textRows);
 
 //----------------------------------------------------------------------------------
 // Gui Setup Functions Definition
 //----------------------------------------------------------------------------------
 
+// Create a new gui context
+// NOTE: Context starts with default style and font, it must be set as current to be used
+GuiContext *GuiCreateContext(void)
+{
+    GuiContext *ctx = (GuiContext *)RAYGUI_CALLOC(1, sizeof(GuiContext));
+
+    if (ctx != NULL)
+    {
+        ctx->state = GUI_STATE_NORMAL;
+        ctx->alpha = 1.0f;
+        memcpy(ctx->style, guiStyleDefault, sizeof(guiStyleDefault));
+        memcpy(ctx->styleColors, guiStyleColorsDefault, sizeof(guiStyleColorsDefault));
+        ctx->tooltipEnabled = true;
+        ctx->textMeasureGeneration = 1;
+    }
+
+    return ctx;
+}
+
+// Destroy a gui context
+// NOTE: If context is current for calling thread, default context is set as current
+void GuiDestroyContext(GuiContext *ctx)
+{
+    if ((ctx == NULL) || (ctx == &guiContextDefault)) return;
+
+    if (guiCtx == ctx) guiCtx = &guiContextDefault;
+
+    RAYGUI_FREE(ctx->drawCommands);
+    RAYGUI_FREE(ctx->drawnCommands);
+    RAYGUI_FREE(ctx->frameCommands);
+
+    GuiTextBlock *block = ctx->drawTextBlocks;
+    while (block != NULL)
+    {
+        GuiTextBlock *next = block->next;
+        RAYGUI_FREE(block->data);
+        RAYGUI_FREE(block);
+        block = next;
+    }
+
+    GuiScratchBlock *scratch = ctx->scratchBlocks;
+    while (scratch != NULL)
+    {
+        GuiScratchBlock *next = scratch->next;
+        RAYGUI_FREE(scratch->data);
+        RAYGUI_FREE(scratch);
+        scratch = next;
+    }
+
+    RAYGUI_FREE(ctx->textBoxExt);
+    RAYGUI_FREE(ctx->styleChanges);
+    RAYGUI_FREE(ctx->styleScopes);
+    RAYGUI_FREE(ctx->hitRects);
+    RAYGUI_FREE(ctx->hitRectsPrev);
+    RAYGUI_FREE(ctx->stateEntries);
+    RAYGUI_FREE(ctx);
+}
+
+// Set current gui context for calling thread
+void GuiSetContext(GuiContext *ctx) { guiCtx = (ctx == NULL)? &guiContextDefault : ctx; }
+
+// Get current gui context for calling thread
+GuiContext *GuiGetContext(void) { return guiCtx; }
+
 // Enable gui global state
 void GuiEnable(void) { guiState = GUI_STATE_NORMAL; }
 
@@ -823,7 +1450,11 @@ void GuiFade(float alpha)
     if (alpha < 0.0f) alpha = 0.0f;
     else if (alpha > 1.0f) alpha = 1.0f;
 
-    guiAlpha = alpha;
+    if (alpha != guiAlpha)
+    {
+        guiAlpha = alpha;
+        GuiUpdateStyleColors();
+    }
 }
 
 // Set gui state (global state)
@@ -838,12 +1469,8 @@ void GuiSetFont(Font font)
 {
     if (font.texture.id > 0)
     {
-        // NOTE: If we try to setup a font but default style has not been
-        // lazily loaded before, it will be overwritten, so we need to force
-        // default style loading first
-        if (!guiStyleLoaded) GuiLoadStyleDefault();
-
         guiFont = font;
+        GuiInvalidateTextMeasure();
         GuiSetStyle(DEFAULT, TEXT_SIZE, font.baseSize);
     }
 }
@@ -857,23 +1484,144 @@ Font GuiGetFont(void)
 // Set control style property value
 void GuiSetStyle(int control, int property, int value)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
+    // Previous values are recorded inside style scopes, to be restored by GuiPopStyle()
+    if (guiCtx->styleScopesCount > 0)
+    {
+        GuiRecordStyle(control*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property);
+
+        if ((control == 0) && (property < NUM_PROPS_DEFAULT))
+        {
+            for (int i = 1; i < NUM_CONTROLS; i++) GuiRecordStyle(i*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property);
+        }
+    }
+
     guiStyle[control*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property] = value;
 
+    // Text measurements depend on text size and spacing
+    if ((control == 0) && ((property == TEXT_SIZE) || (property == TEXT_SPACING))) GuiInvalidateTextMeasure();
+
+    // Color properties are resolved for drawing
+    Color color = { 0 };
+    if (property < NUM_PROPS_COLORS)
+    {
+        color = Fade(GetColor(value), guiAlpha);
+        guiStyleColors[control*NUM_PROPS_COLORS + property] = color;
+    }
+
     // Default properties are propagated to all controls
     if ((control == 0) && (property < NUM_PROPS_DEFAULT))
     {
-        for (int i = 1; i < NUM_CONTROLS; i++) guiStyle[i*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property] = value;
+        for (int i = 1; i < NUM_CONTROLS; i++)
+        {
+            guiStyle[i*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property] = value;
+            if (property < NUM_PROPS_COLORS) guiStyleColors[i*NUM_PROPS_COLORS + property] = color;
+        }
     }
 }
 
 // Get control style property value
 int GuiGetStyle(int control, int property)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
     return guiStyle[control*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property];
 }
 
+// Get style color property resolved for drawing, same as Fade(GetColor(GuiGetStyle(control, property)), guiAlpha)
+// NOTE: Only color properties (property < NUM_PROPS_COLORS) are resolved
+static Color GuiGetStyleColor(int control, int property)
+{
+    return guiStyleColors[control*NUM_PROPS_COLORS + property];
+}
+
+// Push style scope, GuiSetStyle() changes are recorded until GuiPopStyle()
+// NOTE: Whole style loading (GuiLoadStyle*()) is not recorded
+void GuiPushStyle(void)
+{
+    if (guiCtx->styleScopesCount >= guiCtx->styleScopesCapacity)
+    {
+        int capacity = (guiCtx->styleScopesCapacity > 0)? 2*guiCtx->styleScopesCapacity : 8;
+        GuiStyleScope *scopes = (GuiStyleScope *)RAYGUI_REALLOC(guiCtx->styleScopes, capacity*sizeof(GuiStyleScope));
+
+        if (scopes == NULL) return;
+
+        guiCtx->styleScopes = scopes;
+        guiCtx->styleScopesCapacity = capacity;
+    }
+
+    guiCtx->styleScopeId++;
+    guiCtx->styleScopes[guiCtx->styleScopesCount].changesStart = guiCtx->styleChangesCount;
+    guiCtx->styleScopes[guiCtx->styleScopesCount].id = guiCtx->styleScopeId;
+    guiCtx->styleScopesCount++;
+}
+
+// Pop style scope, style properties changed since GuiPushStyle() are restored
+// NOTE: Only changed properties are restored, resolved colors are updated for them
+void GuiPopStyle(void)
+{
+    if (guiCtx->styleScopesCount == 0) return;
+
+    guiCtx->styleScopesCount--;
+    int changesStart = guiCtx->styleScopes[guiCtx->styleScopesCount].changesStart;
+    bool textChanged = false;
+
+    for (int i = guiCtx->styleChangesCount - 1; i >= changesStart; i--)
+    {
+        GuiStyleChange change = guiCtx->styleChanges[i];
+        int control = change.index/(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED);
+        int property = change.index%(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED);
+
+        guiStyle[change.index] = change.value;
+        guiCtx->styleRecorded[change.index] = change.scope;
+
+        if (property < NUM_PROPS_COLORS) guiStyleColors[control*NUM_PROPS_COLORS + property] = Fade(GetColor(change.value), guiAlpha);
+        else if ((control == 0) && ((property == TEXT_SIZE) || (property == TEXT_SPACING))) textChanged = true;
+    }
+
+    guiCtx->styleChangesCount = changesStart;
+
+    // Text measurements depend on text size and spacing
+    if (textChanged) GuiInvalidateTextMeasure();
+}
+
+// Record style property previous value on current style scope
+// NOTE: Property is only recorded on its first change inside the scope
+static void GuiRecordStyle(int index)
+{
+    unsigned int scope = guiCtx->styleScopes[guiCtx->styleScopesCount - 1].id;
+
+    if (guiCtx->styleRecorded[index] == scope) return;
+
+    if (guiCtx->styleChangesCount >= guiCtx->styleChangesCapacity)
+    {
+        int capacity = (guiCtx->styleChangesCapacity > 0)? 2*guiCtx->styleChangesCapacity : 64;
+        GuiStyleChange *changes = (GuiStyleChange *)RAYGUI_REALLOC(guiCtx->styleChanges, capacity*sizeof(GuiStyleChange));
+
+        if (changes == NULL) return;
+
+        guiCtx->styleChanges = changes;
+        guiCtx->styleChangesCapacity = capacity;
+    }
+
+    GuiStyleChange *change = &guiCtx->styleChanges[guiCtx->styleChangesCount];
+    change->index = index;
+    change->value = guiStyle[index];
+    change->scope = guiCtx->styleRecorded[index];
+    guiCtx->styleChangesCount++;
+
+    guiCtx->styleRecorded[index] = scope;
+}
+
+// Resolve all style colors for drawing
+static void GuiUpdateStyleColors(void)
+{
+    for (int i = 0; i < NUM_CONTROLS; i++)
+    {
+        for (int j = 0; j < NUM_PROPS_COLORS; j++)
+        {
+            guiStyleColors[i*NUM_PROPS_COLORS + j] = Fade(GetColor(guiStyle[i*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + j]), guiAlpha);
+        }
+    }
+}
+
 // Enable gui tooltips
 void GuiEnableTooltip(void) { guiTooltipEnabled = true; }
 
@@ -886,124 +1634,469 @@ void GuiSetTooltip(const char *tooltip) { guiTooltip = tooltip; }
 // Clear any tooltip registered
 void GuiClearTooltip(void) { guiTooltip = NULL; }
 
-//----------------------------------------------------------------------------------
-// Gui Controls Functions Definition
-//----------------------------------------------------------------------------------
-
-// Window Box control
-bool GuiWindowBox(Rectangle bounds, const char *title)
+// Update hit testing, current frame controls bounds are kept to resolve topmost control on next frame
+// NOTE: Call it once per frame (i.e. after all controls), hit testing is not active until first call
+void GuiUpdateHitTest(void)
 {
-    // NOTE: This define is also used by GuiMessageBox() and GuiTextInputBox()
-    #define WINDOW_STATUSBAR_HEIGHT        22
+    Rectangle *rects = guiCtx->hitRectsPrev;
+    int capacity = guiCtx->hitRectsPrevCapacity;
 
-    GuiControlState state = guiState;
-    bool clicked = false;
+    guiCtx->hitRectsPrev = guiCtx->hitRects;
+    guiCtx->hitRectsPrevCapacity = guiCtx->hitRectsCapacity;
+    guiCtx->hitRectsPrevCount = guiCtx->hitRectsDiscarded? 0 : guiCtx->hitRectsCount;  // Incomplete frame does not overlap controls
 
-    int statusBarHeight = WINDOW_STATUSBAR_HEIGHT + 2*GuiGetStyle(STATUSBAR, BORDER_WIDTH);
-    statusBarHeight += (statusBarHeight%2);
+    guiCtx->hitRects = rects;
+    guiCtx->hitRectsCapacity = capacity;
+    guiCtx->hitRectsCount = 0;
+    guiCtx->hitRectsDiscarded = false;
 
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, statusBarHeight };
-    if (bounds.height < statusBarHeight*2) bounds.height = statusBarHeight*2;
+    guiCtx->hitTopmostState = GUI_HIT_UNRESOLVED;
+    guiCtx->hitTestActive = true;
 
-    Rectangle closeButtonRec = { statusBar.x + statusBar.width - GuiGetStyle(STATUSBAR, BORDER_WIDTH) - 20,
-                                 statusBar.y + statusBarHeight/2 - 18/2, 18, 18 };
+    // Frame boundary, release scratch allocations (draw-list frames reset on GuiEndFrame())
+    if (!guiDrawListActive) GuiResetScratch();
+}
 
-    // Update control
-    //--------------------------------------------------------------------
-    // NOTE: Logic is directly managed by button
-    //--------------------------------------------------------------------
+// Push id scope hashed from string, ids got inside the scope are unique to it
+void GuiPushId(const char *str)
+{
+    unsigned int seed = GuiGetId(str);
 
-    // Draw control
-    //--------------------------------------------------------------------
+    if (guiCtx->idStackCount < IDSTACK_MAX_SIZE) guiCtx->idStack[guiCtx->idStackCount] = seed;
+    guiCtx->idStackCount++;
+}
 
-    // Draw window base
-    DrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(DEFAULT, BORDER + (state*3))), guiAlpha));
-    DrawRectangleRec(RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH),
-                                  bounds.width - GuiGetStyle(DEFAULT, BORDER_WIDTH)*2, bounds.height - GuiGetStyle(DEFAULT, BORDER_WIDTH)*2 },
-                                  Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), guiAlpha));
+// Push id scope hashed from pointer, ids got inside the scope are unique to it
+void GuiPushIdPtr(const void *ptr)
+{
+    unsigned int seed = GuiGetIdPtr(ptr);
 
-    // Draw window header as status bar
-    GuiStatusBar(statusBar, title);
+    if (guiCtx->idStackCount < IDSTACK_MAX_SIZE) guiCtx->idStack[guiCtx->idStackCount] = seed;
+    guiCtx->idStackCount++;
+}
 
-    // Draw window close button
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
-#if defined(RAYGUI_SUPPORT_ICONS)
-    clicked = GuiButton(closeButtonRec, GuiIconText(RICON_CROSS_SMALL, NULL, 0));
-#else
-    clicked = GuiButton(closeButtonRec, "x");
-#endif
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
-    //--------------------------------------------------------------------
+// Pop id scope
+void GuiPopId(void)
+{
+    if (guiCtx->idStackCount > 0) guiCtx->idStackCount--;
+}
 
-    return clicked;
+// Get control id hashed from string on current id scope
+unsigned int GuiGetId(const char *str)
+{
+    int scope = (guiCtx->idStackCount < IDSTACK_MAX_SIZE)? guiCtx->idStackCount : IDSTACK_MAX_SIZE;
+    unsigned int seed = (scope > 0)? guiCtx->idStack[scope - 1] : 2166136261u;
+
+    return GuiHashId(seed, str, (str == NULL)? 0 : (int)strlen(str));
 }
 
-// Group Box control with text name
-void GuiGroupBox(Rectangle bounds, const char *text)
+// Get control id hashed from pointer on current id scope
+// NOTE: Pointer value is hashed (not pointed data), controls use their data pointer (i.e. text buffer)
+unsigned int GuiGetIdPtr(const void *ptr)
 {
-    #define GROUPBOX_LINE_THICK     1
-    #define GROUPBOX_TEXT_PADDING  10
+    int scope = (guiCtx->idStackCount < IDSTACK_MAX_SIZE)? guiCtx->idStackCount : IDSTACK_MAX_SIZE;
+    unsigned int seed = (scope > 0)? guiCtx->idStack[scope - 1] : 2166136261u;
 
-    GuiControlState state = guiState;
+    return GuiHashId(seed, &ptr, sizeof(ptr));
+}
 
-    // Draw control
-    //--------------------------------------------------------------------
-    DrawRectangle(bounds.x, bounds.y, GROUPBOX_LINE_THICK, bounds.height, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha));
-    DrawRectangle(bounds.x, bounds.y + bounds.height - 1, bounds.width, GROUPBOX_LINE_THICK, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha));
-    DrawRectangle(bounds.x + bounds.width - 1, bounds.y, GROUPBOX_LINE_THICK, bounds.height, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha));
+// Get control state data, zeroed when the control id is first used
+// NOTE: Returned pointer is only valid until next GuiGetStateData() call (table could grow),
+// data should be copied by controls at the beginning and stored back at the end
+void *GuiGetStateData(unsigned int id)
+{
+    GuiStateEntry *entry = NULL;
 
-    GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, bounds.width, 1 }, text);
-    //--------------------------------------------------------------------
+    // Keep table load under 75%, probing sequences remain short
+    if ((guiCtx->stateEntriesCount + 1)*4 > guiCtx->stateEntriesCapacity*3) GuiResizeStateTable((guiCtx->stateEntriesCapacity == 0)? 64 : guiCtx->stateEntriesCapacity*2);
+
+    if (guiCtx->stateEntriesCapacity > 0)
+    {
+        unsigned int mask = guiCtx->stateEntriesCapacity - 1;
+
+        for (unsigned int i = id & mask; ; i = (i + 1) & mask)
+        {
+            entry = &guiCtx->stateEntries[i];
+
+            if (entry->id == id) break;
+            else if (entry->id == 0)
+            {
+                if ((guiCtx->stateEntriesCount + 1)*4 > guiCtx->stateEntriesCapacity*3) entry = NULL;   // Table could not grow
+                else
+                {
+                    entry->id = id;
+                    memset(&entry->data, 0, sizeof(entry->data));
+                    guiCtx->stateEntriesCount++;
+                }
+                break;
+            }
+        }
+    }
+
+    // On allocation failure, state is stored into a discarded entry (reset every time)
+    if (entry == NULL)
+    {
+        entry = &guiCtx->stateDiscarded;
+        memset(&entry->data, 0, sizeof(entry->data));
+    }
+
+    return &entry->data;
 }
 
-// Line control
-void GuiLine(Rectangle bounds, const char *text)
+// Remove control state data
+// NOTE: Following entries of the probing sequence are shifted back, no deleted markers are required
+void GuiRemoveStateData(unsigned int id)
 {
-    #define LINE_TEXT_PADDING  10
+    if (guiCtx->stateEntriesCapacity == 0) return;
 
-    GuiControlState state = guiState;
+    unsigned int mask = guiCtx->stateEntriesCapacity - 1;
+    unsigned int i = id & mask;
 
-    Color color = Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha);
+    while (guiCtx->stateEntries[i].id != id)
+    {
+        if (guiCtx->stateEntries[i].id == 0) return;
+        i = (i + 1) & mask;
+    }
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text == NULL) DrawRectangle(bounds.x, bounds.y + bounds.height/2, bounds.width, 1, color);
-    else
+    for (unsigned int j = (i + 1) & mask; guiCtx->stateEntries[j].id != 0; j = (j + 1) & mask)
     {
-        Rectangle textBounds = { 0 };
-        textBounds.width = GetTextWidth(text);      // TODO: Consider text icon
-        textBounds.height = GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + LINE_TEXT_PADDING;
-        textBounds.y = bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        // Entry could be moved to the removed one if it is not between its home slot and the removed one
+        unsigned int home = guiCtx->stateEntries[j].id & mask;
 
-        // Draw line with embedded text label: "--- text --------------"
-        DrawRectangle(bounds.x, bounds.y, LINE_TEXT_PADDING - 2, 1, color);
-        GuiLabel(textBounds, text);
-        DrawRectangle(bounds.x + LINE_TEXT_PADDING + textBounds.width + 4, bounds.y, bounds.width - textBounds.width - LINE_TEXT_PADDING - 4, 1, color);
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+            guiCtx->stateEntries[i] = guiCtx->stateEntries[j];
+            i = j;
+        }
     }
-    //--------------------------------------------------------------------
+
+    guiCtx->stateEntries[i].id = 0;
+    guiCtx->stateEntriesCount--;
 }
 
-// Panel control
-void GuiPanel(Rectangle bounds)
+// Begin clip area, nested in current one (intersected with it)
+// NOTE: Controls fully outside clip area skip input and drawing, partially visible controls are
+// scissored and only react to mouse over their visible part. Clip areas must be ended with GuiEndClip()
+// WARNING: In draw-list mode scissor changes are recorded as commands, replaying them overrides any
+// scissor mode set around GuiDrawCommands()
+void GuiBeginClip(Rectangle bounds)
 {
-    #define PANEL_BORDER_WIDTH   1
+    Rectangle clip = GuiClipRec(bounds);
 
-    GuiControlState state = guiState;
+    if (guiCtx->clipStackCount < CLIPSTACK_MAX_SIZE) guiCtx->clipStack[guiCtx->clipStackCount] = clip;
+    guiCtx->clipStackCount++;
 
-    // Draw control
-    //--------------------------------------------------------------------
-    DrawRectangleRec(bounds, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BASE_COLOR_DISABLED : BACKGROUND_COLOR)), guiAlpha));
-    DrawRectangleLinesEx(bounds, PANEL_BORDER_WIDTH, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED: LINE_COLOR)), guiAlpha));
-    //--------------------------------------------------------------------
+    int scope = (guiCtx->clipStackCount < CLIPSTACK_MAX_SIZE)? guiCtx->clipStackCount : CLIPSTACK_MAX_SIZE;
+    GuiDrawScissor(guiCtx->clipStack[scope - 1], false);
 }
 
-// Scroll Panel control
-Rectangle GuiScrollPanel(Rectangle bounds, Rectangle content, Vector2 *scroll)
+// End clip area, parent clip area is restored (or scissor mode ended)
+void GuiEndClip(void)
+{
+    if (guiCtx->clipStackCount <= 0) return;
+
+    int scope = (guiCtx->clipStackCount < CLIPSTACK_MAX_SIZE)? guiCtx->clipStackCount : CLIPSTACK_MAX_SIZE;
+    Rectangle clip = guiCtx->clipStack[scope - 1];
+
+    guiCtx->clipStackCount--;
+
+    if (guiCtx->clipStackCount > 0)
+    {
+        scope = (guiCtx->clipStackCount < CLIPSTACK_MAX_SIZE)? guiCtx->clipStackCount : CLIPSTACK_MAX_SIZE;
+        GuiDrawScissor(guiCtx->clipStack[scope - 1], false);
+    }
+    else GuiDrawScissor(clip, true);
+}
+
+// Begin gui frame, controls draw commands are recorded into frame draw list
+// NOTE: Previous frame commands and text storage are reused
+void GuiBeginFrame(void)
+{
+    // Previous frame was not ended (GuiEndFrame() skipped), release its scratch allocations
+    if (guiDrawListActive) GuiResetScratch();
+
+    guiDrawListActive = true;
+    guiDrawCommandsCount = 0;
+
+    for (GuiTextBlock *block = guiDrawTextBlocks; block != NULL; block = block->next) block->used = 0;
+}
+
+// End gui frame, recorded draw commands are submitted to backend and scratch arena is reset
+// NOTE: In case GuiNeedsRedraw() returns false, this call could be skipped
+void GuiEndFrame(void)
+{
+    guiDrawListActive = false;
+
+    // Keep drawn frame commands, required to compute dirty rectangles on next frame
+    bool keepDrawn = GuiReserveDrawnCommands(guiDrawCommandsCount);
+
+    guiCtx->drawnSignature = GuiHashDrawCommands(guiDrawCommands, guiDrawCommandsCount, keepDrawn? guiCtx->drawnCommands : NULL);
+    guiCtx->drawnSignatureValid = keepDrawn;
+    guiCtx->drawnCommandsCount = keepDrawn? guiDrawCommandsCount : 0;
+
+    GuiDrawCommands(guiDrawCommands, guiDrawCommandsCount);
+
+    GuiResetScratch();
+}
+
+// Check if current frame draw list differs from last drawn frame
+// NOTE: Call it after controls, before GuiEndFrame(). Signature covers everything controls
+// draw (states, text, cursors and blinking phase, colors, font, icons) but not textures content
+bool GuiNeedsRedraw(void)
+{
+    if (!guiCtx->drawnSignatureValid) return true;
+
+    return (GuiHashDrawCommands(guiDrawCommands, guiDrawCommandsCount, NULL) != guiCtx->drawnSignature);
+}
+
+// Get screen areas changed since last drawn frame
+// NOTE: Call it after controls, before GuiEndFrame(). Changed, added and removed commands
+// bounds are reported (merged, rounded to pixels); drawing all commands scissored to those
+// areas over last drawn frame produces current frame. Returned array is valid until next call.
+// WARNING: On first frame (or after allocation failure) all commands bounds are reported
+Rectangle *GuiGetDirtyRects(int *count)
+{
+    int dirtyCount = 0;
+    Rectangle *dirty = guiCtx->dirtyRects;
+
+    if (guiCtx->drawnSignatureValid && GuiReserveDrawnCommands(guiDrawCommandsCount))
+    {
+        GuiDrawnCommand *frame = guiCtx->frameCommands;
+        GuiDrawnCommand *drawn = guiCtx->drawnCommands;
+        int frameCount = 0;
+
+        GuiHashDrawCommands(guiDrawCommands, guiDrawCommandsCount, frame);
+        for (int i = 0; i < guiDrawCommandsCount; i++) if (guiDrawCommands[i].type != GUI_DRAWCMD_NONE) frame[frameCount++] = frame[i];
+        qsort(frame, frameCount, sizeof(GuiDrawnCommand), GuiCompareDrawnCommands);
+
+        // Walk both sorted lists, unmatched commands (removed or added) are dirty
+        int i = 0, k = 0;
+        while ((i < guiCtx->drawnCommandsCount) || (k < frameCount))
+        {
+            if ((k >= frameCount) || ((i < guiCtx->drawnCommandsCount) && (drawn[i].hash < frame[k].hash))) dirtyCount = GuiAddDirtyRect(dirty, dirtyCount, drawn[i++].rec);
+            else if ((i >= guiCtx->drawnCommandsCount) || (frame[k].hash < drawn[i].hash)) dirtyCount = GuiAddDirtyRect(dirty, dirtyCount, frame[k++].rec);
+            else { i++; k++; }
+        }
+    }
+    else
+    {
+        for (int i = 0; i < guiDrawCommandsCount; i++)
+        {
+            if (guiDrawCommands[i].type != GUI_DRAWCMD_NONE) dirtyCount = GuiAddDirtyRect(dirty, dirtyCount, guiDrawCommands[i].rec);
+        }
+    }
+
+    if (count != NULL) *count = dirtyCount;
+
+    return dirty;
+}
+
+// Get scratch arena capacity and high-water mark (maximum bytes used in a frame)
+// NOTE: Use it to tune SCRATCH_ARENA_BLOCK_SIZE, arena allocates a new block when capacity is exceeded
+void GuiGetScratchStats(int *capacity, int *highWater)
+{
+    if (capacity != NULL)
+    {
+        *capacity = 0;
+        for (GuiScratchBlock *block = guiCtx->scratchBlocks; block != NULL; block = block->next) *capacity += block->size;
+    }
+
+    if (highWater != NULL) *highWater = guiCtx->scratchHighWater;
+}
+
+// Reset scratch arena, all previous allocations are released (blocks memory is kept)
+// NOTE: Called by GuiEndFrame() and GuiUpdateHitTest(), immediate mode programs not using
+// them should call it once per frame, text helpers results are not valid after it
+void GuiResetScratch(void)
+{
+    for (GuiScratchBlock *block = guiCtx->scratchBlocks; block != NULL; block = block->next) block->used = 0;
+
+    guiCtx->scratchCurrent = guiCtx->scratchBlocks;
+    guiCtx->scratchUsed = 0;
+}
+
+// Get current frame draw commands
+// NOTE: Commands could be culled (GUI_DRAWCMD_NONE), sorted or modified before GuiEndFrame()
+GuiDrawCommand *GuiGetDrawCommands(int *count)
+{
+    if (count != NULL) *count = guiDrawCommandsCount;
+
+    return guiDrawCommands;
+}
+
+// Draw a list of commands using backend drawing functions
+void GuiDrawCommands(const GuiDrawCommand *commands, int count)
+{
+    // Commands are always drawn directly, even if called inside a gui frame
+    bool drawListActive = guiDrawListActive;
+    guiDrawListActive = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        const GuiDrawCommand *cmd = &commands[i];
+
+        switch (cmd->type)
+        {
+            case GUI_DRAWCMD_RECTANGLE: DrawRectangle(cmd->rec.x, cmd->rec.y, cmd->rec.width, cmd->rec.height, cmd->color[0]); break;
+            case GUI_DRAWCMD_GRADIENT: DrawRectangleGradientEx(cmd->rec, cmd->color[0], cmd->color[1], cmd->color[2], cmd->color[3]); break;
+            case GUI_DRAWCMD_TRIANGLE: DrawTriangle(cmd->data.vertex[0], cmd->data.vertex[1], cmd->data.vertex[2], cmd->color[0]); break;
+            case GUI_DRAWCMD_TEXT:
+            {
+                DrawTextEx(guiFont, cmd->data.text.text, RAYGUI_CLITERAL(Vector2){ cmd->rec.x, cmd->rec.y }, cmd->data.text.fontSize, cmd->data.text.spacing, cmd->color[0]);
+            } break;
+            case GUI_DRAWCMD_TEXT_REC:
+            {
+            #if defined(RAYGUI_STANDALONE)
+                // NOTE: Text selection not supported by standalone backend
+                DrawTextRec(guiFont, cmd->data.text.text, cmd->rec, cmd->data.text.fontSize, cmd->data.text.spacing, cmd->data.text.wordWrap, cmd->color[0]);
+            #else
+                DrawTextRecEx(guiFont, cmd->data.text.text, cmd->rec, cmd->data.text.fontSize, cmd->data.text.spacing, cmd->data.text.wordWrap, cmd->color[0],
+                              cmd->data.text.selectStart, cmd->data.text.selectLength, cmd->color[1], cmd->color[2]);
+            #endif
+            } break;
+        #if defined(RAYGUI_SUPPORT_ICONS)
+            case GUI_DRAWCMD_ICON: GuiDrawIcon(cmd->data.icon.iconId, RAYGUI_CLITERAL(Vector2){ cmd->rec.x, cmd->rec.y }, cmd->data.icon.pixelSize, cmd->color[0]); break;
+        #endif
+            case GUI_DRAWCMD_TEXTURE: DrawTextureRec(cmd->data.texture.texture, cmd->data.texture.source, RAYGUI_CLITERAL(Vector2){ cmd->rec.x, cmd->rec.y }, cmd->color[0]); break;
+            case GUI_DRAWCMD_SCISSOR: BeginScissorMode(cmd->rec.x, cmd->rec.y, cmd->rec.width, cmd->rec.height); break;
+            case GUI_DRAWCMD_SCISSOR_END: EndScissorMode(); break;
+            default: break;
+        }
+    }
+
+    guiDrawListActive = drawListActive;
+}
+
+//----------------------------------------------------------------------------------
+// Gui Controls Functions Definition
+//----------------------------------------------------------------------------------
+
+// Window Box control
+bool GuiWindowBox(Rectangle bounds, const char *title)
+{
+    // NOTE: This define is also used by GuiMessageBox() and GuiTextInputBox()
+    #define WINDOW_STATUSBAR_HEIGHT        22
+
+    GuiControlState state = guiState;
+    bool clicked = false;
+
+    int statusBarHeight = WINDOW_STATUSBAR_HEIGHT + 2*GuiGetStyle(STATUSBAR, BORDER_WIDTH);
+    statusBarHeight += (statusBarHeight%2);
+
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, statusBarHeight };
+    if (bounds.height < statusBarHeight*2) bounds.height = statusBarHeight*2;
+
+    if (GuiIsClipped(bounds)) return false;
+
+    Rectangle closeButtonRec = { statusBar.x + statusBar.width - GuiGetStyle(STATUSBAR, BORDER_WIDTH) - 20,
+                                 statusBar.y + statusBarHeight/2 - 18/2, 18, 18 };
+
+    // Update control
+    //--------------------------------------------------------------------
+    // NOTE: Logic is directly managed by button
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+
+    // Draw window base
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), GuiGetStyleColor(DEFAULT, BORDER + (state*3)));
+    GuiDrawRectangleRec(RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH),
+                                  bounds.width - GuiGetStyle(DEFAULT, BORDER_WIDTH)*2, bounds.height - GuiGetStyle(DEFAULT, BORDER_WIDTH)*2 },
+                                  Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), guiAlpha));
+
+    // Draw window header as status bar
+    GuiStatusBar(statusBar, title);
+
+    // Draw window close button
+    GuiPushStyle();
+    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
+    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
+#if defined(RAYGUI_SUPPORT_ICONS)
+    clicked = GuiButton(closeButtonRec, GuiIconText(RICON_CROSS_SMALL, NULL, 0));
+#else
+    clicked = GuiButton(closeButtonRec, "x");
+#endif
+    GuiPopStyle();
+    //--------------------------------------------------------------------
+
+    return clicked;
+}
+
+// Group Box control with text name
+void GuiGroupBox(Rectangle bounds, const char *text)
+{
+    #define GROUPBOX_LINE_THICK     1
+    #define GROUPBOX_TEXT_PADDING  10
+
+    GuiControlState state = guiState;
+
+    if (GuiIsClipped(bounds)) return;
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangle(bounds.x, bounds.y, GROUPBOX_LINE_THICK, bounds.height, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha));
+    GuiDrawRectangle(bounds.x, bounds.y + bounds.height - 1, bounds.width, GROUPBOX_LINE_THICK, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha));
+    GuiDrawRectangle(bounds.x + bounds.width - 1, bounds.y, GROUPBOX_LINE_THICK, bounds.height, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha));
+
+    GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, bounds.width, 1 }, text);
+    //--------------------------------------------------------------------
+}
+
+// Line control
+void GuiLine(Rectangle bounds, const char *text)
+{
+    #define LINE_TEXT_PADDING  10
+
+    GuiControlState state = guiState;
+
+    if (GuiIsClipped(bounds)) return;
+
+    Color color = Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)), guiAlpha);
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (text == NULL) GuiDrawRectangle(bounds.x, bounds.y + bounds.height/2, bounds.width, 1, color);
+    else
+    {
+        Rectangle textBounds = { 0 };
+        textBounds.width = GetTextWidth(text);      // TODO: Consider text icon
+        textBounds.height = GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + LINE_TEXT_PADDING;
+        textBounds.y = bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+
+        // Draw line with embedded text label: "--- text --------------"
+        GuiDrawRectangle(bounds.x, bounds.y, LINE_TEXT_PADDING - 2, 1, color);
+        GuiLabel(textBounds, text);
+        GuiDrawRectangle(bounds.x + LINE_TEXT_PADDING + textBounds.width + 4, bounds.y, bounds.width - textBounds.width - LINE_TEXT_PADDING - 4, 1, color);
+    }
+    //--------------------------------------------------------------------
+}
+
+// Panel control
+void GuiPanel(Rectangle bounds)
+{
+    #define PANEL_BORDER_WIDTH   1
+
+    GuiControlState state = guiState;
+
+    if (GuiIsClipped(bounds)) return;
+
+    // Update control
+    //--------------------------------------------------------------------
+    // NOTE: Panel does not react to mouse, its bounds are only registered to overlap controls below
+    if ((state != GUI_STATE_DISABLED) && !guiLocked) GuiCheckHitRec(GetMousePosition(), bounds);
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangleRec(bounds, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BASE_COLOR_DISABLED : BACKGROUND_COLOR)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, PANEL_BORDER_WIDTH, Fade(GetColor(GuiGetStyle(DEFAULT, (state == GUI_STATE_DISABLED)? BORDER_COLOR_DISABLED: LINE_COLOR)), guiAlpha));
+    //--------------------------------------------------------------------
+}
+
+// Scroll Panel control
+Rectangle GuiScrollPanel(Rectangle bounds, Rectangle content, Vector2 *scroll)
 {
     GuiControlState state = guiState;
 
@@ -1037,6 +2130,9 @@ Rectangle GuiScrollPanel(Rectangle bounds, Rectangle content, Vector2 *scroll)
     const int verticalMin = hasVerticalScrollBar? -GuiGetStyle(DEFAULT, BORDER_WIDTH) : -GuiGetStyle(DEFAULT, BORDER_WIDTH);
     const int verticalMax = hasVerticalScrollBar? content.height - bounds.height + horizontalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH) : -GuiGetStyle(DEFAULT, BORDER_WIDTH);
 
+    // NOTE: View is still returned, content controls are culled by their own bounds
+    if (GuiIsClipped(bounds)) return view;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1044,7 +2140,7 @@ Rectangle GuiScrollPanel(Rectangle bounds, Rectangle content, Vector2 *scroll)
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRecEx(mousePoint, bounds, true))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else state = GUI_STATE_FOCUSED;
@@ -1074,10 +2170,10 @@ Rectangle GuiScrollPanel(Rectangle bounds, Rectangle content, Vector2 *scroll)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleRec(bounds, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
+    GuiDrawRectangleRec(bounds, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
 
-    // Save size of the scrollbar slider
-    const int slider = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+    // Scrollbar slider size is changed for this control only
+    GuiPushStyle();
 
     // Draw horizontal scrollbar if visible
     if (hasHorizontalScrollBar)
@@ -1099,17 +2195,17 @@ Rectangle GuiScrollPanel(Rectangle bounds, Rectangle content, Vector2 *scroll)
     if (hasHorizontalScrollBar && hasVerticalScrollBar)
     {
         // TODO: Consider scroll bars side
-        DrawRectangle(horizontalScrollBar.x + horizontalScrollBar.width + 2,
+        GuiDrawRectangle(horizontalScrollBar.x + horizontalScrollBar.width + 2,
                       verticalScrollBar.y + verticalScrollBar.height + 2,
                       horizontalScrollBarWidth - 4, verticalScrollBarWidth - 4,
-                      Fade(GetColor(GuiGetStyle(LISTVIEW, TEXT + (state*3))), guiAlpha));
+                      GuiGetStyleColor(LISTVIEW, TEXT + (state*3)));
     }
 
     // Set scrollbar slider size back to the way it was before
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, slider);
+    GuiPopStyle();
 
     // Draw scrollbar lines depending on current state
-    DrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, (float)BORDER + (state*3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + (state*3)));
     //--------------------------------------------------------------------
 
     if (scroll != NULL) *scroll = scrollPos;
@@ -1122,6 +2218,8 @@ void GuiLabel(Rectangle bounds, const char *text)
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClipped(bounds)) return;
+
     // Update control
     //--------------------------------------------------------------------
     // ...
@@ -1131,7 +2229,7 @@ void GuiLabel(Rectangle bounds, const char *text)
     //--------------------------------------------------------------------
     GuiDrawText(text, 
                 GetTextBounds(LABEL, bounds), 
-                GuiGetStyle(LABEL, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(LABEL, (state == GUI_STATE_DISABLED) ? TEXT_COLOR_DISABLED : TEXT_COLOR_NORMAL)), guiAlpha));
+                GuiGetStyle(LABEL, TEXT_ALIGNMENT), GuiGetStyleColor(LABEL, (state == GUI_STATE_DISABLED) ? TEXT_COLOR_DISABLED : TEXT_COLOR_NORMAL));
     //--------------------------------------------------------------------
 }
 
@@ -1142,6 +2240,8 @@ bool GuiButton(Rectangle bounds, const char *text)
     GuiControlState state = guiState;
     bool pressed = false;
 
+    if (GuiIsClipped(bounds)) return false;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1149,7 +2249,7 @@ bool GuiButton(Rectangle bounds, const char *text)
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else state = GUI_STATE_FOCUSED;
@@ -1161,8 +2261,8 @@ bool GuiButton(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(BUTTON, BORDER + (state * 3))), guiAlpha));
-    DrawRectangle(bounds.x + GuiGetStyle(BUTTON, BORDER_WIDTH), bounds.y + GuiGetStyle(BUTTON, BORDER_WIDTH), bounds.width - 2 * GuiGetStyle(BUTTON, BORDER_WIDTH), bounds.height - 2 * GuiGetStyle(BUTTON, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(BUTTON, BASE + (state * 3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GuiGetStyleColor(BUTTON, BORDER + (state * 3)));
+    GuiDrawRectangle(bounds.x + GuiGetStyle(BUTTON, BORDER_WIDTH), bounds.y + GuiGetStyle(BUTTON, BORDER_WIDTH), bounds.width - 2 * GuiGetStyle(BUTTON, BORDER_WIDTH), bounds.height - 2 * GuiGetStyle(BUTTON, BORDER_WIDTH), GuiGetStyleColor(BUTTON, BASE + (state * 3)));
 
     //Trim text to fit into bounds
     snprintf(cpyText, sizeof(cpyText), "%s", text);
@@ -1171,7 +2271,7 @@ bool GuiButton(Rectangle bounds, const char *text)
         cpyText[strlen(cpyText) - 1] = '\0';
     }
 
-    GuiDrawText(cpyText, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(BUTTON, TEXT + (state * 3))), guiAlpha));
+    GuiDrawText(cpyText, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GuiGetStyleColor(BUTTON, TEXT + (state * 3)));
 
     GuiDrawTooltip(bounds);
     //------------------------------------------------------------------
@@ -1186,9 +2286,11 @@ bool GuiLabelButton(Rectangle bounds, const char *text)
     bool pressed = false;
 
     // NOTE: We force bounds.width to be all text
-    int textWidth = MeasureTextEx(guiFont, text, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING)).x;
+    int textWidth = GuiMeasureText(text, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING)).x;
     if (bounds.width < textWidth) bounds.width = textWidth;
 
+    if (GuiIsClipped(bounds)) return false;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1196,7 +2298,7 @@ bool GuiLabelButton(Rectangle bounds, const char *text)
         Vector2 mousePoint = GetMousePosition();
 
         // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else state = GUI_STATE_FOCUSED;
@@ -1208,7 +2310,7 @@ bool GuiLabelButton(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(LABEL, TEXT + (state*3))), guiAlpha));
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return pressed;
@@ -1217,7 +2319,7 @@ bool GuiLabelButton(Rectangle bounds, const char *text)
 // Image button control, returns true when clicked
 bool GuiImageButton(Rectangle bounds, const char *text, Texture2D texture, int color) {
   bool rc;
-  int oldColor = GuiGetStyle(BUTTON, TEXT_COLOR_NORMAL);
+  GuiPushStyle();
 
   if (color != 0)
     GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, color);
@@ -1228,7 +2330,7 @@ bool GuiImageButton(Rectangle bounds, const char *text, Texture2D texture, int c
         (float)texture.height
       });
 
-  GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, oldColor);
+  GuiPopStyle();
   return rc;
 }
 
@@ -1238,6 +2340,8 @@ bool GuiImageButtonEx(Rectangle bounds, const char *text, Texture2D texture, Rec
     GuiControlState state = guiState;
     bool clicked = false;
 
+    if (GuiIsClipped(bounds)) return false;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1245,7 +2349,7 @@ bool GuiImageButtonEx(Rectangle bounds, const char *text, Texture2D texture, Rec
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) clicked = true;
@@ -1256,28 +2360,28 @@ bool GuiImageButtonEx(Rectangle bounds, const char *text, Texture2D texture, Rec
 
     // Draw control
     //--------------------------------------------------------------------
-    // DrawRectangleLinesEx(
+    // GuiDrawRectangleLinesEx(
     //     bounds, GuiGetStyle(BUTTON, BORDER_WIDTH),
-    //     Fade(GetColor(GuiGetStyle(BUTTON, BORDER + (state * 3))), guiAlpha));
-    // DrawRectangle(
+    //     GuiGetStyleColor(BUTTON, BORDER + (state * 3)));
+    // GuiDrawRectangle(
     //     bounds.x + GuiGetStyle(BUTTON, BORDER_WIDTH),
     //     bounds.y + GuiGetStyle(BUTTON, BORDER_WIDTH),
     //     bounds.width - 2 * GuiGetStyle(BUTTON, BORDER_WIDTH),
     //     bounds.height - 2 * GuiGetStyle(BUTTON, BORDER_WIDTH),
-    //     Fade(GetColor(GuiGetStyle(BUTTON, BASE + (state * 3))), guiAlpha));
+    //     GuiGetStyleColor(BUTTON, BASE + (state * 3)));
 
     if (text != NULL)
       GuiDrawText(
           text, GetTextBounds(BUTTON, bounds),
           GuiGetStyle(BUTTON, TEXT_ALIGNMENT),
-          Fade(GetColor(GuiGetStyle(BUTTON, TEXT + (state * 3))), guiAlpha));
+          GuiGetStyleColor(BUTTON, TEXT + (state * 3)));
     if (texture.id > 0)
-      DrawTextureRec(
+      GuiDrawTextureRec(
           texture, texSource,
           RAYGUI_CLITERAL(Vector2){
               bounds.x + bounds.width / 2 - texture.width / 2,
               bounds.y + bounds.height / 2 - texture.height / 2},
-          Fade(GetColor(GuiGetStyle(BUTTON, TEXT + (state * 3))), guiAlpha));
+          GuiGetStyleColor(BUTTON, TEXT + (state * 3)));
     //------------------------------------------------------------------
 
     return clicked;
@@ -1288,6 +2392,8 @@ bool GuiToggle(Rectangle bounds, const char *text, bool active)
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClipped(bounds)) return active;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1295,7 +2401,7 @@ bool GuiToggle(Rectangle bounds, const char *text, bool active)
         Vector2 mousePoint = GetMousePosition();
 
         // Check toggle button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
@@ -1312,33 +2418,30 @@ bool GuiToggle(Rectangle bounds, const char *text, bool active)
     //--------------------------------------------------------------------
  //   if (state == GUI_STATE_NORMAL)
     {
-        DrawRectangleLinesEx(
+        GuiDrawRectangleLinesEx(
             bounds, 
             GuiGetStyle(TOGGLE, BORDER_WIDTH), 
-            Fade(GetColor(GuiGetStyle(TOGGLE, (active ? BORDER_COLOR_PRESSED : (BORDER + state * 3)))), 
-            guiAlpha));
+            GuiGetStyleColor(TOGGLE, (active ? BORDER_COLOR_PRESSED : (BORDER + state * 3))));
 
-        DrawRectangle(
+        GuiDrawRectangle(
             bounds.x + GuiGetStyle(TOGGLE, BORDER_WIDTH), 
             bounds.y + GuiGetStyle(TOGGLE, BORDER_WIDTH), 
             bounds.width - 2 * GuiGetStyle(TOGGLE, BORDER_WIDTH),
             bounds.height - 2 * GuiGetStyle(TOGGLE, BORDER_WIDTH), 
-            Fade(GetColor(GuiGetStyle(TOGGLE, (active ? BASE_COLOR_PRESSED : (BASE + state * 3)))),
-            guiAlpha));
+            GuiGetStyleColor(TOGGLE, (active ? BASE_COLOR_PRESSED : (BASE + state * 3))));
 
         GuiDrawText(
             text, 
             GetTextBounds(TOGGLE, bounds), 
             GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), 
-            Fade(GetColor(GuiGetStyle(TOGGLE, (active ? TEXT_COLOR_PRESSED : (TEXT + state * 3)))), 
-            guiAlpha));
+            GuiGetStyleColor(TOGGLE, (active ? TEXT_COLOR_PRESSED : (TEXT + state * 3))));
     }
     // else
     // {
-    //     DrawRectangleLinesEx(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TOGGLE, BORDER + state*3)), guiAlpha));
-    //     DrawRectangle(bounds.x + GuiGetStyle(TOGGLE, BORDER_WIDTH), bounds.y + GuiGetStyle(TOGGLE, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TOGGLE, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TOGGLE, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TOGGLE, BASE + state*3)), guiAlpha));
+    //     GuiDrawRectangleLinesEx(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GuiGetStyleColor(TOGGLE, BORDER + state*3));
+    //     GuiDrawRectangle(bounds.x + GuiGetStyle(TOGGLE, BORDER_WIDTH), bounds.y + GuiGetStyle(TOGGLE, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TOGGLE, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TOGGLE, BORDER_WIDTH), GuiGetStyleColor(TOGGLE, BASE + state*3));
 
-    //     GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(TOGGLE, TEXT + state*3)), guiAlpha));
+    //     GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GuiGetStyleColor(TOGGLE, TEXT + state*3));
     // }
     //--------------------------------------------------------------------
 
@@ -1348,16 +2451,12 @@ bool GuiToggle(Rectangle bounds, const char *text, bool active)
 // Toggle Group control, returns toggled button index
 int GuiToggleGroup(Rectangle bounds, const char *text, int active)
 {
-    #if !defined(TOGGLEGROUP_MAX_ELEMENTS)
-        #define TOGGLEGROUP_MAX_ELEMENTS    32
-    #endif
-
     float initBoundsX = bounds.x;
 
-    // Get substrings items from text (items pointers)
-    int rows[TOGGLEGROUP_MAX_ELEMENTS] = { 0 };
+    // Get substrings items from text (items pointers) and their rows
+    int *rows = NULL;
     int itemsCount = 0;
-    const char **items = GuiTextSplit(text, &itemsCount, rows);
+    const char **items = GuiTextSplit(text, &itemsCount, &rows);
 
     int prevRow = rows[0];
 
@@ -1395,6 +2494,8 @@ bool GuiCheckBox(Rectangle bounds, const char *text, bool checked)
         if (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(CHECKBOX, TEXT_PADDING);
     }
 
+    if (GuiIsClipped(bounds) && ((text == NULL) || GuiIsClipped(textBounds))) return checked;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1409,7 +2510,7 @@ bool GuiCheckBox(Rectangle bounds, const char *text, bool checked)
         };
 
         // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, totalBounds))
+        if (GuiCheckHitRec(mousePoint, totalBounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else state = GUI_STATE_FOCUSED;
@@ -1421,14 +2522,14 @@ bool GuiCheckBox(Rectangle bounds, const char *text, bool checked)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(CHECKBOX, BORDER + (state*3))), guiAlpha));
-    if (checked) DrawRectangle(bounds.x + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GuiGetStyleColor(CHECKBOX, BORDER + (state*3)));
+    if (checked) GuiDrawRectangle(bounds.x + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
                                bounds.y + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
                                bounds.width - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
                                bounds.height - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
-                               Fade(GetColor(GuiGetStyle(CHECKBOX, TEXT + state*3)), guiAlpha));
+                               GuiGetStyleColor(CHECKBOX, TEXT + state*3));
 
-    if (text != NULL) GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_RIGHT)? GUI_TEXT_ALIGN_LEFT : GUI_TEXT_ALIGN_RIGHT, Fade(GetColor(GuiGetStyle(LABEL, TEXT + (state*3))), guiAlpha));
+    if (text != NULL) GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_RIGHT)? GUI_TEXT_ALIGN_LEFT : GUI_TEXT_ALIGN_RIGHT, GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     return checked;
@@ -1439,6 +2540,8 @@ int GuiComboBox(Rectangle bounds, const char *text, int active)
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClipped(bounds)) return active;
+
     bounds.width -= (GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH) + GuiGetStyle(COMBOBOX, COMBO_BUTTON_PADDING));
 
     Rectangle selector = { (float)bounds.x + bounds.width + GuiGetStyle(COMBOBOX, COMBO_BUTTON_PADDING),
@@ -1457,8 +2560,8 @@ int GuiComboBox(Rectangle bounds, const char *text, int active)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds) ||
-            CheckCollisionPointRec(mousePoint, selector))
+        if (GuiCheckHitRec(mousePoint, bounds) ||
+            GuiCheckHitRec(mousePoint, selector))
         {
             if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
             {
@@ -1475,22 +2578,20 @@ int GuiComboBox(Rectangle bounds, const char *text, int active)
     // Draw control
     //--------------------------------------------------------------------
     // Draw combo box main
-    DrawRectangleLinesEx(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(COMBOBOX, BORDER + (state*3))), guiAlpha));
-    DrawRectangle(bounds.x + GuiGetStyle(COMBOBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(COMBOBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(COMBOBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(COMBOBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(COMBOBOX, BASE + (state*3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GuiGetStyleColor(COMBOBOX, BORDER + (state*3)));
+    GuiDrawRectangle(bounds.x + GuiGetStyle(COMBOBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(COMBOBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(COMBOBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(COMBOBOX, BORDER_WIDTH), GuiGetStyleColor(COMBOBOX, BASE + (state*3)));
 
-    GuiDrawText(items[active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(COMBOBOX, TEXT + (state*3))), guiAlpha));
+    GuiDrawText(items[active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GuiGetStyleColor(COMBOBOX, TEXT + (state*3)));
 
     // Draw selector using a custom button
     // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiPushStyle();
     GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
     GuiSetStyle(BUTTON, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
 
     GuiButton(selector, TextFormat("%i/%i", active + 1, itemsCount));
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return active;
@@ -1511,6 +2612,8 @@ bool GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMo
     Rectangle boundsOpen = bounds;
     boundsOpen.height = (itemsCount + 1)*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_PADDING));
 
+    if (GuiIsClipped(editMode? boundsOpen : bounds)) return false;
+
     Rectangle itemBounds = bounds;
 
     bool pressed = false;       // Check mouse button pressed
@@ -1534,21 +2637,27 @@ bool GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMo
             // Check if already selected item has been pressed again
             if (CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) pressed = true;
 
-            // Check focused and selected item
-            for (int i = 0; i < itemsCount; i++)
+            // Check focused and selected item (no need to iterate items)
+            float itemStride = bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_PADDING);
+
+            if ((itemStride > 0) && (mousePoint.y >= (bounds.y + itemStride)))
             {
-                // Update item rectangle y position for next item
-                itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_PADDING));
+                int i = (int)((mousePoint.y - bounds.y - itemStride)/itemStride);
 
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
+                if (i < itemsCount)
                 {
-                    itemFocused = i;
-                    if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+                    // Update item rectangle y position for focused item
+                    itemBounds.y += (i + 1)*itemStride;
+
+                    if (CheckCollisionPointRec(mousePoint, itemBounds))
                     {
-                        itemSelected = i;
-                        pressed = true;     // Item selected, change to editMode = false
+                        itemFocused = i;
+                        if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+                        {
+                            itemSelected = i;
+                            pressed = true;     // Item selected, change to editMode = false
+                        }
                     }
-                    break;
                 }
             }
 
@@ -1556,7 +2665,7 @@ bool GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMo
         }
         else
         {
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (GuiCheckHitRec(mousePoint, bounds))
             {
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
                 {
@@ -1573,9 +2682,9 @@ bool GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMo
     //--------------------------------------------------------------------
     if (editMode) GuiPanel(boundsOpen);
 
-    DrawRectangle(bounds.x, bounds.y, bounds.width, bounds.height, Fade(GetColor(GuiGetStyle(DROPDOWNBOX, BASE + state*3)), guiAlpha));
-    DrawRectangleLinesEx(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, BORDER + state*3)), guiAlpha));
-    GuiDrawText(items[itemSelected], GetTextBounds(DEFAULT, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + state*3)), guiAlpha));
+    GuiDrawRectangle(bounds.x, bounds.y, bounds.width, bounds.height, GuiGetStyleColor(DROPDOWNBOX, BASE + state*3));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GuiGetStyleColor(DROPDOWNBOX, BORDER + state*3));
+    GuiDrawText(items[itemSelected], GetTextBounds(DEFAULT, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT + state*3));
 
     if (editMode)
     {
@@ -1587,28 +2696,28 @@ bool GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMo
 
             if (i == itemSelected)
             {
-                DrawRectangleRec(itemBounds, Fade(GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_PRESSED)), guiAlpha));
-                DrawRectangleLinesEx(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_PRESSED)), guiAlpha));
-                GuiDrawText(items[i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_PRESSED)), guiAlpha));
+                GuiDrawRectangleRec(itemBounds, GuiGetStyleColor(DROPDOWNBOX, BASE_COLOR_PRESSED));
+                GuiDrawRectangleLinesEx(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GuiGetStyleColor(DROPDOWNBOX, BORDER_COLOR_PRESSED));
+                GuiDrawText(items[i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT_COLOR_PRESSED));
             }
             else if (i == itemFocused)
             {
-                DrawRectangleRec(itemBounds, Fade(GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_FOCUSED)), guiAlpha));
-                DrawRectangleLinesEx(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_FOCUSED)), guiAlpha));
-                GuiDrawText(items[i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_FOCUSED)), guiAlpha));
+                GuiDrawRectangleRec(itemBounds, GuiGetStyleColor(DROPDOWNBOX, BASE_COLOR_FOCUSED));
+                GuiDrawRectangleLinesEx(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GuiGetStyleColor(DROPDOWNBOX, BORDER_COLOR_FOCUSED));
+                GuiDrawText(items[i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT_COLOR_FOCUSED));
             }
-            else GuiDrawText(items[i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_NORMAL)), guiAlpha));
+            else GuiDrawText(items[i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GuiGetStyleColor(DROPDOWNBOX, TEXT_COLOR_NORMAL));
         }
     }
 
     // TODO: Avoid this function, use icon instead or 'v'
-    DrawTriangle(RAYGUI_CLITERAL(Vector2){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 2 },
+    GuiDrawTriangle(RAYGUI_CLITERAL(Vector2){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 2 },
                  RAYGUI_CLITERAL(Vector2){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING) + 5, bounds.y + bounds.height/2 - 2 + 5 },
                  RAYGUI_CLITERAL(Vector2){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING) + 10, bounds.y + bounds.height/2 - 2 },
-                 Fade(GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))), guiAlpha));
+                 GuiGetStyleColor(DROPDOWNBOX, TEXT + (state*3)));
 
     //GuiDrawText("v", RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - GuiGetStyle(DROPDOWNBOX, ARROW_PADDING), bounds.y + bounds.height/2 - 2, 10, 10 },
-    //            GUI_TEXT_ALIGN_CENTER, Fade(GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + (state*3))), guiAlpha));
+    //            GUI_TEXT_ALIGN_CENTER, GuiGetStyleColor(DROPDOWNBOX, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
     *active = itemSelected;
@@ -1616,12 +2725,16 @@ bool GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMo
 }
 
 // Text Box control, updates input text
-// NOTE 1: Requires static variables: framesCounter
+// NOTE 1: Blinking cursor frames counter is kept on control state table while editing
 // NOTE 2: Returns if KEY_ENTER pressed (useful for data validation)
 bool GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
 {
 	char cpyText[256];
-    static int framesCounter = 0;           // Required for blinking cursor
+
+    if (GuiIsClipped(bounds)) return false;
+
+    unsigned int id = GuiGetIdPtr(text);     // Control id, text edit state is kept per control
+    int framesCounter = editMode? *(int *)GuiGetStateData(id) : 0;     // Required for blinking cursor
 
     GuiControlState state = guiState;
     bool pressed = false;
@@ -1691,7 +2804,7 @@ bool GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
         }
         else
         {
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (GuiCheckHitRec(mousePoint, bounds))
             {
                 state = GUI_STATE_FOCUSED;
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) pressed = true;
@@ -1704,21 +2817,20 @@ bool GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds,
+    GuiDrawRectangleLinesEx(bounds,
                          GuiGetStyle(TEXTBOX, BORDER_WIDTH),
-                         Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))),
-                         guiAlpha));
+                         GuiGetStyleColor(TEXTBOX, BORDER + (state*3)));
 
     if (state == GUI_STATE_PRESSED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_PRESSED));
 
         // Draw blinking cursor
-        if (editMode && ((framesCounter/20)%2 == 0)) DrawRectangleRec(cursor, Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)), guiAlpha));
+        if (editMode && ((framesCounter/20)%2 == 0)) GuiDrawRectangleRec(cursor, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
     }
     else if (state == GUI_STATE_DISABLED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
     }
 
     //Trim text to fit into bounds
@@ -1729,9 +2841,13 @@ bool GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
     }
 
     GuiDrawText(cpyText, GetTextBounds(TEXTBOX, bounds), GuiGetStyle(TEXTBOX, TEXT_ALIGNMENT),
-    			Fade(GetColor(GuiGetStyle(TEXTBOX, TEXT + (state*3))), guiAlpha));
+    			GuiGetStyleColor(TEXTBOX, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
+    // State is only kept while editing, leaving edit mode releases it
+    if (editMode && !pressed) *(int *)GuiGetStateData(id) = framesCounter;
+    else GuiRemoveStateData(id);
+
     return pressed;
 }
 
@@ -1741,6 +2857,7 @@ bool GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, in
     GuiControlState state = guiState;
 
     bool pressed = false;
+    int prevValue = *value;
     int tempValue = *value;
 
     Rectangle spinner = { bounds.x + GuiGetStyle(SPINNER, SPIN_BUTTON_WIDTH) + GuiGetStyle(SPINNER, SPIN_BUTTON_PADDING), bounds.y,
@@ -1758,6 +2875,8 @@ bool GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, in
         if (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SPINNER, TEXT_PADDING);
     }
 
+    if (GuiIsClipped(bounds) && ((text == NULL) || GuiIsClipped(textBounds))) return false;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1765,7 +2884,7 @@ bool GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, in
         Vector2 mousePoint = GetMousePosition();
 
         // Check spinner state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRecEx(mousePoint, bounds, true))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else state = GUI_STATE_FOCUSED;
@@ -1782,12 +2901,14 @@ bool GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, in
     // Draw control
     //--------------------------------------------------------------------
     // TODO: Set Spinner properties for ValueBox
-    pressed = GuiValueBox(spinner, NULL, &tempValue, minValue, maxValue, editMode);
+    // NOTE: Value box edits user value (not a local copy), its id is got from value pointer
+    *value = tempValue;
+    pressed = GuiValueBox(spinner, NULL, value, minValue, maxValue, editMode);
+    tempValue = *value;
 
     // Draw value selector custom buttons
     // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiPushStyle();
     GuiSetStyle(BUTTON, BORDER_WIDTH, GuiGetStyle(SPINNER, BORDER_WIDTH));
     GuiSetStyle(BUTTON, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
 
@@ -1799,14 +2920,13 @@ bool GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, in
     if (GuiButton(rightButtonBound, ">")) tempValue++;
 #endif
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    GuiPopStyle();
 
     // Draw text label if provided
-    if (text != NULL) GuiDrawText(text, textBounds, (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_RIGHT)? GUI_TEXT_ALIGN_LEFT : GUI_TEXT_ALIGN_RIGHT, Fade(GetColor(GuiGetStyle(LABEL, TEXT + (state*3))), guiAlpha));
+    if (text != NULL) GuiDrawText(text, textBounds, (GuiGetStyle(SPINNER, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_RIGHT)? GUI_TEXT_ALIGN_LEFT : GUI_TEXT_ALIGN_RIGHT, GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
-    if (tempValue != *value)
+    if (tempValue != prevValue)
         pressed = true;
 
     *value = tempValue;
@@ -1814,14 +2934,15 @@ bool GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, in
 }
 
 // Value Box control, updates input text with numbers
-// NOTE: Requires static variables: framesCounter
+// NOTE: Blinking cursor frames counter is kept on control state table while editing
 bool GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode)
 {
     #if !defined(VALUEBOX_MAX_CHARS)
         #define VALUEBOX_MAX_CHARS  32
     #endif
 
-    static int framesCounter = 0;           // Required for blinking cursor
+    unsigned int id = GuiGetIdPtr(value);     // Control id, text edit state is kept per control
+    int framesCounter = editMode? *(int *)GuiGetStateData(id) : 0;     // Required for blinking cursor
 
     GuiControlState state = guiState;
     bool pressed = false;
@@ -1839,6 +2960,8 @@ bool GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, i
         if (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(VALUEBOX, TEXT_PADDING);
     }
 
+    if (GuiIsClipped(bounds) && ((text == NULL) || GuiIsClipped(textBounds))) return false;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -1900,7 +3023,7 @@ bool GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, i
             if (*value > maxValue) *value = maxValue;
             else if (*value < minValue) *value = minValue;
 
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (GuiCheckHitRec(mousePoint, bounds))
             {
                 state = GUI_STATE_FOCUSED;
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) pressed = true;
@@ -1913,34 +3036,41 @@ bool GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, i
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GuiGetStyleColor(VALUEBOX, BORDER + (state*3)));
 
     if (state == GUI_STATE_PRESSED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), GuiGetStyleColor(VALUEBOX, BASE_COLOR_PRESSED));
 
         // Draw blinking cursor
         // NOTE: ValueBox internal text is always centered
-        if (editMode && ((framesCounter/20)%2 == 0)) DrawRectangle(bounds.x + GetTextWidth(textValue)/2 + bounds.width/2 + 2, bounds.y + 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), 1, bounds.height - 4*GuiGetStyle(VALUEBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(VALUEBOX, BORDER_COLOR_PRESSED)), guiAlpha));
+        if (editMode && ((framesCounter/20)%2 == 0)) GuiDrawRectangle(bounds.x + GetTextWidth(textValue)/2 + bounds.width/2 + 2, bounds.y + 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), 1, bounds.height - 4*GuiGetStyle(VALUEBOX, BORDER_WIDTH), GuiGetStyleColor(VALUEBOX, BORDER_COLOR_PRESSED));
     }
     else if (state == GUI_STATE_DISABLED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(VALUEBOX, BORDER_WIDTH), GuiGetStyleColor(VALUEBOX, BASE_COLOR_DISABLED));
     }
 
-    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), GUI_TEXT_ALIGN_CENTER, Fade(GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))), guiAlpha));
+    GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), GUI_TEXT_ALIGN_CENTER, GuiGetStyleColor(VALUEBOX, TEXT + (state*3)));
 
     // Draw text label if provided
-    if (text != NULL) GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_RIGHT)? GUI_TEXT_ALIGN_LEFT : GUI_TEXT_ALIGN_RIGHT, Fade(GetColor(GuiGetStyle(LABEL, TEXT + (state*3))), guiAlpha));
+    if (text != NULL) GuiDrawText(text, textBounds, (GuiGetStyle(VALUEBOX, TEXT_ALIGNMENT) == GUI_TEXT_ALIGN_RIGHT)? GUI_TEXT_ALIGN_LEFT : GUI_TEXT_ALIGN_RIGHT, GuiGetStyleColor(LABEL, TEXT + (state*3)));
     //--------------------------------------------------------------------
 
+    // State is only kept while editing, leaving edit mode releases it
+    if (editMode && !pressed) *(int *)GuiGetStateData(id) = framesCounter;
+    else GuiRemoveStateData(id);
+
     return pressed;
 }
 
 // Text Box control with multiple lines
 bool GuiTextBoxMulti(Rectangle bounds, char *text, int textSize, bool editMode)
 {
-    static int framesCounter = 0;           // Required for blinking cursor
+    if (GuiIsClipped(bounds)) return false;
+
+    unsigned int id = GuiGetIdPtr(text);     // Control id, text edit state is kept per control
+    int framesCounter = editMode? *(int *)GuiGetStateData(id) : 0;     // Required for blinking cursor
 
     GuiControlState state = guiState;
     bool pressed = false;
@@ -1975,7 +3105,7 @@ bool GuiTextBoxMulti(Rectangle bounds, char *text, int textSize, bool editMode)
             // Introduce characters
             if (keyCount < (textSize - 1))
             {
-                Vector2 textSize = MeasureTextEx(guiFont, text, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
+                Vector2 textSize = GuiMeasureText(text, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
                 
                 if (textSize.y < (textAreaBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
                 {
@@ -2039,7 +3169,7 @@ bool GuiTextBoxMulti(Rectangle bounds, char *text, int textSize, bool editMode)
         }
         else
         {
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (GuiCheckHitRec(mousePoint, bounds))
             {
                 state = GUI_STATE_FOCUSED;
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) pressed = true;
@@ -2052,23 +3182,28 @@ bool GuiTextBoxMulti(Rectangle bounds, char *text, int textSize, bool editMode)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BORDER + (state*3)));
 
     if (state == GUI_STATE_PRESSED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_PRESSED));
 
         // Draw blinking cursor
-        if (editMode && ((framesCounter/20)%2 == 0)) DrawRectangleRec(cursor, Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)), guiAlpha));
+        if (editMode && ((framesCounter/20)%2 == 0)) GuiDrawRectangleRec(cursor, GuiGetStyleColor(TEXTBOX, BORDER_COLOR_PRESSED));
     }
     else if (state == GUI_STATE_DISABLED)
     {
-        DrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)), guiAlpha));
+        GuiDrawRectangle(bounds.x + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.y + GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(TEXTBOX, BORDER_WIDTH), GuiGetStyleColor(TEXTBOX, BASE_COLOR_DISABLED));
     }
 
-    DrawTextRec(guiFont, text, textAreaBounds, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), true, Fade(GetColor(GuiGetStyle(TEXTBOX, TEXT + (state*3))), guiAlpha));
+    Color textColor = GuiGetStyleColor(TEXTBOX, TEXT + (state*3));
+    GuiDrawTextRec(text, textAreaBounds, GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING), true, textColor, 0, 0, textColor, textColor);
     //--------------------------------------------------------------------
 
+    // State is only kept while editing, leaving edit mode releases it
+    if (editMode && !pressed) *(int *)GuiGetStateData(id) = framesCounter;
+    else GuiRemoveStateData(id);
+
     return pressed;
 }
 
@@ -2078,6 +3213,8 @@ float GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClippedText(bounds, textLeft, textRight, GuiGetStyle(SLIDER, TEXT_PADDING))) return value;
+
     int sliderValue = (int)(((value - minValue)/(maxValue - minValue))*(bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH)));
 
     Rectangle slider = { bounds.x, bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
@@ -2100,7 +3237,7 @@ float GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -2133,12 +3270,12 @@ float GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(SLIDER, BORDER + (state*3))), guiAlpha));
-    DrawRectangle(bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH), bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(SLIDER, (state != GUI_STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GuiGetStyleColor(SLIDER, BORDER + (state*3)));
+    GuiDrawRectangle(bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH), bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH), bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH), GuiGetStyleColor(SLIDER, (state != GUI_STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED));
 
     // Draw slider internal bar (depends on state)
-    if ((state == GUI_STATE_NORMAL) || (state == GUI_STATE_PRESSED)) DrawRectangleRec(slider, Fade(GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)), guiAlpha));
-    else if (state == GUI_STATE_FOCUSED) DrawRectangleRec(slider, Fade(GetColor(GuiGetStyle(SLIDER, TEXT_COLOR_FOCUSED)), guiAlpha));
+    if ((state == GUI_STATE_NORMAL) || (state == GUI_STATE_PRESSED)) GuiDrawRectangleRec(slider, GuiGetStyleColor(SLIDER, BASE_COLOR_PRESSED));
+    else if (state == GUI_STATE_FOCUSED) GuiDrawRectangleRec(slider, GuiGetStyleColor(SLIDER, TEXT_COLOR_FOCUSED));
 
     // Draw left/right text if provided
     if (textLeft != NULL)
@@ -2149,7 +3286,7 @@ float GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight
         textBounds.x = bounds.x - textBounds.width - GuiGetStyle(SLIDER, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textLeft, textBounds, GUI_TEXT_ALIGN_RIGHT, Fade(GetColor(GuiGetStyle(SLIDER, TEXT + (state*3))), guiAlpha));
+        GuiDrawText(textLeft, textBounds, GUI_TEXT_ALIGN_RIGHT, GuiGetStyleColor(SLIDER, TEXT + (state*3)));
     }
 
     if (textRight != NULL)
@@ -2160,7 +3297,7 @@ float GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight
         textBounds.x = bounds.x + bounds.width + GuiGetStyle(SLIDER, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textRight, textBounds, GUI_TEXT_ALIGN_LEFT, Fade(GetColor(GuiGetStyle(SLIDER, TEXT + (state*3))), guiAlpha));
+        GuiDrawText(textRight, textBounds, GUI_TEXT_ALIGN_LEFT, GuiGetStyleColor(SLIDER, TEXT + (state*3)));
     }
     //--------------------------------------------------------------------
 
@@ -2184,6 +3321,8 @@ float GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRig
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClippedText(bounds, textLeft, textRight, GuiGetStyle(PROGRESSBAR, TEXT_PADDING))) return value;
+
     Rectangle progress = { bounds.x + GuiGetStyle(PROGRESSBAR, BORDER_WIDTH),
                            bounds.y + GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) + GuiGetStyle(PROGRESSBAR, PROGRESS_PADDING), 0,
                            bounds.height - 2*GuiGetStyle(PROGRESSBAR, BORDER_WIDTH) - 2*GuiGetStyle(PROGRESSBAR, PROGRESS_PADDING) };
@@ -2195,11 +3334,11 @@ float GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRig
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(PROGRESSBAR, BORDER + (state*3))), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), GuiGetStyleColor(PROGRESSBAR, BORDER + (state*3)));
 
     // Draw slider internal progress bar (depends on state)
-    if ((state == GUI_STATE_NORMAL) || (state == GUI_STATE_PRESSED)) DrawRectangleRec(progress, Fade(GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)), guiAlpha));
-    else if (state == GUI_STATE_FOCUSED) DrawRectangleRec(progress, Fade(GetColor(GuiGetStyle(PROGRESSBAR, TEXT_COLOR_FOCUSED)), guiAlpha));
+    if ((state == GUI_STATE_NORMAL) || (state == GUI_STATE_PRESSED)) GuiDrawRectangleRec(progress, GuiGetStyleColor(PROGRESSBAR, BASE_COLOR_PRESSED));
+    else if (state == GUI_STATE_FOCUSED) GuiDrawRectangleRec(progress, GuiGetStyleColor(PROGRESSBAR, TEXT_COLOR_FOCUSED));
 
     // Draw left/right text if provided
     if (textLeft != NULL)
@@ -2210,7 +3349,7 @@ float GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRig
         textBounds.x = bounds.x - textBounds.width - GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textLeft, textBounds, GUI_TEXT_ALIGN_RIGHT, Fade(GetColor(GuiGetStyle(PROGRESSBAR, TEXT + (state*3))), guiAlpha));
+        GuiDrawText(textLeft, textBounds, GUI_TEXT_ALIGN_RIGHT, GuiGetStyleColor(PROGRESSBAR, TEXT + (state*3)));
     }
 
     if (textRight != NULL)
@@ -2221,7 +3360,7 @@ float GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRig
         textBounds.x = bounds.x + bounds.width + GuiGetStyle(PROGRESSBAR, TEXT_PADDING);
         textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-        GuiDrawText(textRight, textBounds, GUI_TEXT_ALIGN_LEFT, Fade(GetColor(GuiGetStyle(PROGRESSBAR, TEXT + (state*3))), guiAlpha));
+        GuiDrawText(textRight, textBounds, GUI_TEXT_ALIGN_LEFT, GuiGetStyleColor(PROGRESSBAR, TEXT + (state*3)));
     }
     //--------------------------------------------------------------------
 
@@ -2233,12 +3372,14 @@ void GuiStatusBar(Rectangle bounds, const char *text)
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClipped(bounds)) return;
+
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleLinesEx(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(STATUSBAR, (state != GUI_STATE_DISABLED)? BORDER_COLOR_NORMAL : BORDER_COLOR_DISABLED)), guiAlpha));
-    DrawRectangleRec(RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(STATUSBAR, BORDER_WIDTH), bounds.y + GuiGetStyle(STATUSBAR, BORDER_WIDTH), bounds.width - GuiGetStyle(STATUSBAR, BORDER_WIDTH)*2, bounds.height - GuiGetStyle(STATUSBAR, BORDER_WIDTH)*2 }, Fade(GetColor(GuiGetStyle(STATUSBAR, (state != GUI_STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GuiGetStyleColor(STATUSBAR, (state != GUI_STATE_DISABLED)? BORDER_COLOR_NORMAL : BORDER_COLOR_DISABLED));
+    GuiDrawRectangleRec(RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(STATUSBAR, BORDER_WIDTH), bounds.y + GuiGetStyle(STATUSBAR, BORDER_WIDTH), bounds.width - GuiGetStyle(STATUSBAR, BORDER_WIDTH)*2, bounds.height - GuiGetStyle(STATUSBAR, BORDER_WIDTH)*2 }, GuiGetStyleColor(STATUSBAR, (state != GUI_STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED));
 
-    GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(STATUSBAR, (state != GUI_STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED)), guiAlpha));
+    GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), GuiGetStyleColor(STATUSBAR, (state != GUI_STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED));
     //--------------------------------------------------------------------
 }
 
@@ -2247,6 +3388,8 @@ void GuiDummyRec(Rectangle bounds, const char *text)
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClipped(bounds)) return;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
@@ -2254,7 +3397,7 @@ void GuiDummyRec(Rectangle bounds, const char *text)
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = GUI_STATE_PRESSED;
             else state = GUI_STATE_FOCUSED;
@@ -2264,18 +3407,28 @@ void GuiDummyRec(Rectangle bounds, const char *text)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleRec(bounds, Fade(GetColor(GuiGetStyle(DEFAULT, (state != GUI_STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)), guiAlpha));
+    GuiDrawRectangleRec(bounds, GuiGetStyleColor(DEFAULT, (state != GUI_STATE_DISABLED)? BASE_COLOR_NORMAL : BASE_COLOR_DISABLED));
 
-    GuiDrawText(text, GetTextBounds(DEFAULT, bounds), GUI_TEXT_ALIGN_CENTER, Fade(GetColor(GuiGetStyle(BUTTON, (state != GUI_STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED)), guiAlpha));
+    GuiDrawText(text, GetTextBounds(DEFAULT, bounds), GUI_TEXT_ALIGN_CENTER, GuiGetStyleColor(BUTTON, (state != GUI_STATE_DISABLED)? TEXT_COLOR_NORMAL : TEXT_COLOR_DISABLED));
     //------------------------------------------------------------------
 }
 
 // Scroll Bar control
-// TODO: I feel GuiScrollBar could be simplified...
 int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
+{
+    return (int)GuiScrollBarEx(bounds, value, minValue, maxValue, (maxValue - minValue)/GuiGetStyle(SCROLLBAR, SCROLL_SPEED), GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE));
+}
+
+// Scroll Bar control with 64-bit range
+// NOTE: Scroll step (arrows) and slider size are provided by caller,
+// positions are computed in double precision to support huge ranges
+// TODO: I feel GuiScrollBar could be simplified...
+static long long GuiScrollBarEx(Rectangle bounds, long long value, long long minValue, long long maxValue, long long step, int sliderSize)
 {
     GuiControlState state = guiState;
 
+    if (GuiIsClipped(bounds)) return value;
+
     // Is the scrollbar horizontal or vertical?
     bool isVertical = (bounds.width > bounds.height)? false : true;
 
@@ -2296,8 +3449,8 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
     if (value > maxValue) value = maxValue;
     if (value < minValue) value = minValue;
 
-    const int range = maxValue - minValue;
-    int sliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+    const long long range = maxValue - minValue;
+    const double position = (range > 0)? (double)(value - minValue)/range : 0.0;    // Slider normalized position
 
     // Calculate rectangles for all of the components
     arrowUpLeft = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize };
@@ -2307,14 +3460,14 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
         arrowDownRight = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + bounds.height - spinnerSize - GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize};
         scrollbar = RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING), arrowUpLeft.y + arrowUpLeft.height, bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING)), bounds.height - arrowUpLeft.height - arrowDownRight.height - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH) };
         sliderSize = (sliderSize >= scrollbar.height)? (scrollbar.height - 2) : sliderSize;     // Make sure the slider won't get outside of the scrollbar
-        slider = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING), (float)scrollbar.y + (int)(((float)(value - minValue)/range)*(scrollbar.height - sliderSize)), (float)bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)), (float)sliderSize };
+        slider = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING), (float)scrollbar.y + (int)(position*(scrollbar.height - sliderSize)), (float)bounds.width - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)), (float)sliderSize };
     }
     else
     {
         arrowDownRight = RAYGUI_CLITERAL(Rectangle){ (float)bounds.x + bounds.width - spinnerSize - GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH), (float)spinnerSize, (float)spinnerSize};
         scrollbar = RAYGUI_CLITERAL(Rectangle){ arrowUpLeft.x + arrowUpLeft.width, bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING), bounds.width - arrowUpLeft.width - arrowDownRight.width - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH), bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_PADDING))};
         sliderSize = (sliderSize >= scrollbar.width)? (scrollbar.width - 2) : sliderSize;       // Make sure the slider won't get outside of the scrollbar
-        slider = RAYGUI_CLITERAL(Rectangle){ (float)scrollbar.x + (int)(((float)(value - minValue)/range)*(scrollbar.width - sliderSize)), (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING), (float)sliderSize, (float)bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)) };
+        slider = RAYGUI_CLITERAL(Rectangle){ (float)scrollbar.x + (int)(position*(scrollbar.width - sliderSize)), (float)bounds.y + GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING), (float)sliderSize, (float)bounds.height - 2*(GuiGetStyle(SCROLLBAR, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING)) };
     }
 
     // Update control
@@ -2323,7 +3476,7 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             state = GUI_STATE_FOCUSED;
 
@@ -2333,8 +3486,8 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
 
             if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
             {
-                if (CheckCollisionPointRec(mousePoint, arrowUpLeft)) value -= range/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                else if (CheckCollisionPointRec(mousePoint, arrowDownRight)) value += range/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                if (CheckCollisionPointRec(mousePoint, arrowUpLeft)) value -= step;
+                else if (CheckCollisionPointRec(mousePoint, arrowDownRight)) value += step;
 
                 state = GUI_STATE_PRESSED;
             }
@@ -2343,12 +3496,12 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
                 if (!isVertical)
                 {
                     Rectangle scrollArea = { arrowUpLeft.x + arrowUpLeft.width, arrowUpLeft.y, scrollbar.width, bounds.height - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH)};
-                    if (CheckCollisionPointRec(mousePoint, scrollArea)) value = ((float)(mousePoint.x - scrollArea.x - slider.width/2)*range)/(scrollArea.width - slider.width) + minValue;
+                    if (CheckCollisionPointRec(mousePoint, scrollArea)) value = (long long)(((double)(mousePoint.x - scrollArea.x - slider.width/2)*range)/(scrollArea.width - slider.width)) + minValue;
                 }
                 else
                 {
                     Rectangle scrollArea = { arrowUpLeft.x, arrowUpLeft.y+arrowUpLeft.height, bounds.width - 2*GuiGetStyle(SCROLLBAR, BORDER_WIDTH),  scrollbar.height};
-                    if (CheckCollisionPointRec(mousePoint, scrollArea)) value = ((float)(mousePoint.y - scrollArea.y - slider.height/2)*range)/(scrollArea.height - slider.height) + minValue;
+                    if (CheckCollisionPointRec(mousePoint, scrollArea)) value = (long long)(((double)(mousePoint.y - scrollArea.y - slider.height/2)*range)/(scrollArea.height - slider.height)) + minValue;
                 }
             }
         }
@@ -2361,12 +3514,12 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleRec(bounds, Fade(GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED)), guiAlpha));   // Draw the background
-    DrawRectangleRec(scrollbar, Fade(GetColor(GuiGetStyle(BUTTON, BASE_COLOR_NORMAL)), guiAlpha));     // Draw the scrollbar active area background
+    GuiDrawRectangleRec(bounds, GuiGetStyleColor(DEFAULT, BORDER_COLOR_DISABLED));   // Draw the background
+    GuiDrawRectangleRec(scrollbar, GuiGetStyleColor(BUTTON, BASE_COLOR_NORMAL));     // Draw the scrollbar active area background
 
-    DrawRectangleLinesEx(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + state*3));
 
-    DrawRectangleRec(slider, Fade(GetColor(GuiGetStyle(SLIDER, BORDER + state*3)), guiAlpha));         // Draw the slider bar
+    GuiDrawRectangleRec(slider, GuiGetStyleColor(SLIDER, BORDER + state*3));         // Draw the slider bar
 
     // Draw arrows
     const int padding = (spinnerSize - GuiGetStyle(SCROLLBAR, ARROWS_SIZE))/2;
@@ -2393,19 +3546,19 @@ int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
         { arrowDownRight.x + spinnerSize - padding, arrowDownRight.y + padding }
     };
 
-    Color lineColor = Fade(GetColor(GuiGetStyle(BUTTON, TEXT + state*3)), guiAlpha);
+    Color lineColor = GuiGetStyleColor(BUTTON, TEXT + state*3);
 
     if (GuiGetStyle(SCROLLBAR, ARROWS_VISIBLE))
     {
         if (isVertical)
         {
-            DrawTriangle(lineCoords[6], lineCoords[7], lineCoords[8], lineColor);
-            DrawTriangle(lineCoords[9], lineCoords[10], lineCoords[11], lineColor);
+            GuiDrawTriangle(lineCoords[6], lineCoords[7], lineCoords[8], lineColor);
+            GuiDrawTriangle(lineCoords[9], lineCoords[10], lineCoords[11], lineColor);
         }
         else
         {
-            DrawTriangle(lineCoords[2], lineCoords[1], lineCoords[0], lineColor);
-            DrawTriangle(lineCoords[5], lineCoords[4], lineCoords[3], lineColor);
+            GuiDrawTriangle(lineCoords[2], lineCoords[1], lineCoords[0], lineColor);
+            GuiDrawTriangle(lineCoords[5], lineCoords[4], lineCoords[3], lineColor);
         }
     }
     //--------------------------------------------------------------------
@@ -2431,6 +3584,8 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *focus, in
     int itemFocused = (focus == NULL)? -1 : *focus;
     int itemSelected = active;
 
+    if (GuiIsClipped(bounds)) return itemSelected;
+
     // Check if we need a scroll bar
     bool useScrollBar = false;
     if (!dontUseScrollbar)
@@ -2461,26 +3616,31 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *focus, in
         Vector2 mousePoint = GetMousePosition();
 
         // Check mouse inside list view
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRecEx(mousePoint, bounds, true))
         {
             state = GUI_STATE_FOCUSED;
 
-            // Check focused and selected item
-            for (int i = 0; i < visibleItems; i++)
+            // Check focused and selected item (no need to iterate items)
+            int itemStride = GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING);
+
+            if ((itemStride > 0) && (mousePoint.y >= itemBounds.y))
             {
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
+                int i = (int)(mousePoint.y - itemBounds.y)/itemStride;
+
+                if (i < visibleItems)
                 {
-                    itemFocused = startIndex + i;
-                    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                    itemBounds.y += i*itemStride;
+
+                    if (CheckCollisionPointRec(mousePoint, itemBounds))
                     {
-                        if (itemSelected == (startIndex + i)) itemSelected = -1;
-                        else itemSelected = startIndex + i;
+                        itemFocused = startIndex + i;
+                        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                        {
+                            if (itemSelected == (startIndex + i)) itemSelected = -1;
+                            else itemSelected = startIndex + i;
+                        }
                     }
-                    break;
                 }
-
-                // Update item rectangle y position for next item
-                itemBounds.y += (GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING));
             }
 
             if (useScrollBar)
@@ -2504,44 +3664,13 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *focus, in
 
     // Draw control
     //--------------------------------------------------------------------
-    DrawRectangleRec(bounds, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
-    DrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleRec(bounds, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + state*3));
 
     // Draw visible items
     for (int i = 0; ((i < visibleItems) && (text != NULL)); i++)
     {
-        if (state == GUI_STATE_DISABLED)
-        {
-            if ((startIndex + i) == itemSelected)
-            {
-                DrawRectangleRec(itemBounds, Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_DISABLED)), guiAlpha));
-                DrawRectangleLinesEx(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_DISABLED)), guiAlpha));
-            }
-
-            GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_DISABLED)), guiAlpha));
-        }
-        else
-        {
-            if ((startIndex + i) == itemSelected)
-            {
-                // Draw item selected
-                DrawRectangleRec(itemBounds, Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_PRESSED)), guiAlpha));
-                DrawRectangleLinesEx(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_PRESSED)), guiAlpha));
-                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_PRESSED)), guiAlpha));
-            }
-            else if ((startIndex + i) == itemFocused)
-            {
-                // Draw item focused
-                DrawRectangleRec(itemBounds, Fade(GetColor(GuiGetStyle(LISTVIEW, BASE_COLOR_FOCUSED)), guiAlpha));
-                DrawRectangleLinesEx(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), Fade(GetColor(GuiGetStyle(LISTVIEW, BORDER_COLOR_FOCUSED)), guiAlpha));
-                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_FOCUSED)), guiAlpha));
-            }
-            else
-            {
-                // Draw item normal
-                GuiDrawText(text[startIndex + i], GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(LISTVIEW, TEXT_COLOR_NORMAL)), guiAlpha));
-            }
-        }
+        GuiDrawListViewItem(itemBounds, text[startIndex + i], state, ((startIndex + i) == itemSelected), ((startIndex + i) == itemFocused));
 
         // Update item rectangle y position for next item
         itemBounds.y += (GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING));
@@ -2559,15 +3688,13 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *focus, in
         float percentVisible = (float)(endIndex - startIndex)/count;
         float sliderSize = bounds.height*percentVisible;
 
-        int prevSliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);   // Save default slider size
-        int prevScrollSpeed = GuiGetStyle(SCROLLBAR, SCROLL_SPEED); // Save default scroll speed
+        GuiPushStyle();
         GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, sliderSize);            // Change slider size
         GuiSetStyle(SCROLLBAR, SCROLL_SPEED, count - visibleItems); // Change scroll speed
 
         startIndex = GuiScrollBar(scrollBarBounds, startIndex, 0, count - visibleItems);
 
-        GuiSetStyle(SCROLLBAR, SCROLL_SPEED, prevScrollSpeed); // Reset scroll speed to default
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, prevSliderSize); // Reset slider size to default
+        GuiPopStyle();      // Reset slider size and scroll speed to previous values
     }
     //--------------------------------------------------------------------
 
@@ -2577,23 +3704,137 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *focus, in
     return itemSelected;
 }
 
-// Color Panel control
-Color GuiColorPanelEx(Rectangle bounds, Color color, float hue)
+// List View control with items requested on demand
+// NOTE: Only visible items are requested to getItem() callback, indices and
+// scrollbar computations are 64-bit to support huge lists (millions of items)
+long long GuiListViewVirtual(Rectangle bounds, long long count, GuiListItemCallback getItem, void *userData, long long *focus, long long *scrollIndex, long long active)
 {
     GuiControlState state = guiState;
-    Vector2 pickerSelector = { 0 };
+    long long itemFocused = (focus == NULL)? -1 : *focus;
+    long long itemSelected = active;
 
-    Vector3 vcolor = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    Vector3 hsv = ConvertRGBtoHSV(vcolor);
+    if (GuiIsClipped(bounds)) return itemSelected;
 
-    pickerSelector.x = bounds.x + (float)hsv.y*bounds.width;            // HSV: Saturation
-    pickerSelector.y = bounds.y + (1.0f - (float)hsv.z)*bounds.height;  // HSV: Value
+    int itemStride = GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING);
+    if (itemStride < 1) itemStride = 1;     // Avoid division by zero or negative strides with invalid styles
 
-    Vector3 maxHue = { hue >= 0.0f ? hue : hsv.x, 1.0f, 1.0f };
-    Vector3 rgbHue = ConvertHSVtoRGB(maxHue);
-    Color maxHueCol = { (unsigned char)(255.0f*rgbHue.x),
-                      (unsigned char)(255.0f*rgbHue.y),
-                      (unsigned char)(255.0f*rgbHue.z), 255 };
+    // Get items on the list
+    long long visibleItems = (long long)bounds.height/itemStride;
+    if (visibleItems > count) visibleItems = count;
+    if (visibleItems < 0) visibleItems = 0;
+
+    // Check if we need a scroll bar
+    bool useScrollBar = (count > visibleItems);
+
+    // Define base item rectangle [0]
+    Rectangle itemBounds = { 0 };
+    itemBounds.x = bounds.x + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING);
+    itemBounds.y = bounds.y + GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING) + GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    itemBounds.width = bounds.width - 2*GuiGetStyle(LISTVIEW, LIST_ITEMS_PADDING) - GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    itemBounds.height = GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT);
+    if (useScrollBar) itemBounds.width -= GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH);
+
+    long long startIndex = (scrollIndex == NULL)? 0 : *scrollIndex;
+    if (startIndex > (count - visibleItems)) startIndex = count - visibleItems;
+    if (startIndex < 0) startIndex = 0;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != GUI_STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GetMousePosition();
+
+        // Check mouse inside list view
+        if (GuiCheckHitRecEx(mousePoint, bounds, true))
+        {
+            state = GUI_STATE_FOCUSED;
+
+            // Check focused and selected item (no need to iterate items)
+            itemFocused = -1;
+
+            if ((mousePoint.x >= itemBounds.x) && (mousePoint.x < (itemBounds.x + itemBounds.width)) && (mousePoint.y >= itemBounds.y))
+            {
+                long long i = (long long)(mousePoint.y - itemBounds.y)/itemStride;
+
+                if ((i < visibleItems) && ((mousePoint.y - itemBounds.y - i*itemStride) < itemBounds.height))
+                {
+                    itemFocused = startIndex + i;
+                    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                    {
+                        if (itemSelected == itemFocused) itemSelected = -1;
+                        else itemSelected = itemFocused;
+                    }
+                }
+            }
+
+            if (useScrollBar)
+            {
+                startIndex -= GetMouseWheelMove();
+
+                if (startIndex < 0) startIndex = 0;
+                else if (startIndex > (count - visibleItems)) startIndex = count - visibleItems;
+            }
+        }
+        else itemFocused = -1;
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangleRec(bounds, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
+    GuiDrawRectangleLinesEx(bounds, GuiGetStyle(DEFAULT, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER + state*3));
+
+    // Draw visible items, only visible items are requested
+    for (long long i = 0; ((i < visibleItems) && (getItem != NULL)); i++)
+    {
+        GuiDrawListViewItem(itemBounds, getItem(startIndex + i, userData), state, ((startIndex + i) == itemSelected), ((startIndex + i) == itemFocused));
+
+        // Update item rectangle y position for next item
+        itemBounds.y += itemStride;
+    }
+
+    if (useScrollBar)
+    {
+        Rectangle scrollBarBounds = {
+            bounds.x + bounds.width - GuiGetStyle(LISTVIEW, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+            bounds.y + GuiGetStyle(LISTVIEW, BORDER_WIDTH), (float)GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH),
+            bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
+        };
+
+        // Calculate percentage of visible items and apply same percentage to scrollbar,
+        // slider size is limited to keep it usable for huge lists
+        int sliderSize = (int)(bounds.height*((double)visibleItems/count));
+        if (sliderSize < GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE)) sliderSize = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+
+        startIndex = GuiScrollBarEx(scrollBarBounds, startIndex, 0, count - visibleItems, 1, sliderSize);
+    }
+    //--------------------------------------------------------------------
+
+    if (focus != NULL) *focus = itemFocused;
+    if (scrollIndex != NULL) *scrollIndex = startIndex;
+
+    return itemSelected;
+}
+
+// Color Panel control
+Color GuiColorPanelEx(Rectangle bounds, Color color, float hue)
+{
+    GuiControlState state = guiState;
+    Vector2 pickerSelector = { 0 };
+
+    if (GuiIsClipped(bounds)) return color;
+
+    Vector3 vcolor = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    Vector3 hsv = ConvertRGBtoHSV(vcolor);
+
+    pickerSelector.x = bounds.x + (float)hsv.y*bounds.width;            // HSV: Saturation
+    pickerSelector.y = bounds.y + (1.0f - (float)hsv.z)*bounds.height;  // HSV: Value
+
+    Vector3 maxHue = { hue >= 0.0f ? hue : hsv.x, 1.0f, 1.0f };
+    Vector3 rgbHue = ConvertHSVtoRGB(maxHue);
+    Color maxHueCol = { (unsigned char)(255.0f*rgbHue.x),
+                      (unsigned char)(255.0f*rgbHue.y),
+                      (unsigned char)(255.0f*rgbHue.z), 255 };
 
     const Color colWhite = { 255, 255, 255, 255 };
     const Color colBlack = { 0, 0, 0, 255 };
@@ -2604,7 +3845,7 @@ Color GuiColorPanelEx(Rectangle bounds, Color color, float hue)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -2638,18 +3879,18 @@ Color GuiColorPanelEx(Rectangle bounds, Color color, float hue)
     //--------------------------------------------------------------------
     if (state != GUI_STATE_DISABLED)
     {
-        DrawRectangleGradientEx(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
-        DrawRectangleGradientEx(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+        GuiDrawRectangleGradientEx(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
+        GuiDrawRectangleGradientEx(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
 
         // Draw color picker: selector
-        DrawRectangle(pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), Fade(colWhite, guiAlpha));
+        GuiDrawRectangle(pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), Fade(colWhite, guiAlpha));
     }
     else
     {
-        DrawRectangleGradientEx(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
+        GuiDrawRectangleGradientEx(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
     }
 
-    DrawRectangleLinesEx(bounds, 1, Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, 1, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
     //--------------------------------------------------------------------
 
     return color;
@@ -2669,14 +3910,16 @@ float GuiColorBarAlpha(Rectangle bounds, float alpha)
     GuiControlState state = guiState;
     Rectangle selector = { (float)bounds.x + alpha*bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (float)bounds.y - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (float)GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT), (float)bounds.height + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)*2 };
 
+    if (GuiIsClipped(bounds)) return alpha;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds) ||
-            CheckCollisionPointRec(mousePoint, selector))
+        if (GuiCheckHitRec(mousePoint, bounds) ||
+            GuiCheckHitRec(mousePoint, selector))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -2706,7 +3949,7 @@ float GuiColorBarAlpha(Rectangle bounds, float alpha)
         {
             for (int y = 0; y < checksY; y++)
             {
-                DrawRectangle(bounds.x + x*COLORBARALPHA_CHECKED_SIZE,
+                GuiDrawRectangle(bounds.x + x*COLORBARALPHA_CHECKED_SIZE,
                               bounds.y + y*COLORBARALPHA_CHECKED_SIZE,
                               COLORBARALPHA_CHECKED_SIZE, COLORBARALPHA_CHECKED_SIZE,
                               ((x + y)%2)? Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.4f), guiAlpha) :
@@ -2714,14 +3957,14 @@ float GuiColorBarAlpha(Rectangle bounds, float alpha)
             }
         }
 
-        DrawRectangleGradientEx(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
+        GuiDrawRectangleGradientEx(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
     }
-    else DrawRectangleGradientEx(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+    else GuiDrawRectangleGradientEx(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), GuiGetStyleColor(COLORPICKER, BORDER_COLOR_DISABLED), GuiGetStyleColor(COLORPICKER, BORDER_COLOR_DISABLED));
 
-    DrawRectangleLinesEx(bounds, 1, Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, 1, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
 
     // Draw alpha bar: selector
-    DrawRectangleRec(selector, Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleRec(selector, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
     //--------------------------------------------------------------------
 
     return alpha;
@@ -2734,14 +3977,16 @@ float GuiColorBarHue(Rectangle bounds, float hue)
     GuiControlState state = guiState;
     Rectangle selector = { (float)bounds.x - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (float)bounds.y + hue/360.0f*bounds.height - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (float)bounds.width + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)*2, (float)GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT) };
 
+    if (GuiIsClipped(bounds)) return hue;
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds) ||
-            CheckCollisionPointRec(mousePoint, selector))
+        if (GuiCheckHitRec(mousePoint, bounds) ||
+            GuiCheckHitRec(mousePoint, selector))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -2774,19 +4019,19 @@ float GuiColorBarHue(Rectangle bounds, float hue)
     if (state != GUI_STATE_DISABLED)
     {
         // Draw hue bar:color bars
-        DrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 255,0,0,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255,255,0,255 }, guiAlpha));
-        DrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + (int)bounds.height/6 + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 255,255,0,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0,255,0,255 }, guiAlpha));
-        DrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 2*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 0,255,0,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0,255,255,255 }, guiAlpha));
-        DrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 3*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 0,255,255,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0,0,255,255 }, guiAlpha));
-        DrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 4*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 0,0,255,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255,0,255,255 }, guiAlpha));
-        DrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 5*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6 - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), Fade(RAYGUI_CLITERAL(Color){ 255,0,255,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255,0,0,255 }, guiAlpha));
+        GuiDrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 255,0,0,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255,255,0,255 }, guiAlpha));
+        GuiDrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + (int)bounds.height/6 + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 255,255,0,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0,255,0,255 }, guiAlpha));
+        GuiDrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 2*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 0,255,0,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0,255,255,255 }, guiAlpha));
+        GuiDrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 3*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 0,255,255,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0,0,255,255 }, guiAlpha));
+        GuiDrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 4*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6, Fade(RAYGUI_CLITERAL(Color){ 0,0,255,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255,0,255,255 }, guiAlpha));
+        GuiDrawRectangleGradientV(bounds.x + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.y + 5*((int)bounds.height/6) + GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW)/2, bounds.width - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), (int)bounds.height/6 - GuiGetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW), Fade(RAYGUI_CLITERAL(Color){ 255,0,255,255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255,0,0,255 }, guiAlpha));
     }
-    else DrawRectangleGradientV(bounds.x, bounds.y, bounds.width, bounds.height, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+    else GuiDrawRectangleGradientV(bounds.x, bounds.y, bounds.width, bounds.height, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), GuiGetStyleColor(COLORPICKER, BORDER_COLOR_DISABLED));
 
-    DrawRectangleLinesEx(bounds, 1, Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleLinesEx(bounds, 1, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
 
     // Draw hue bar: selector
-    DrawRectangleRec(selector, Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), guiAlpha));
+    GuiDrawRectangleRec(selector, GuiGetStyleColor(COLORPICKER, BORDER + state*3));
     //--------------------------------------------------------------------
 
     return hue;
@@ -2826,6 +4071,8 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
 
     int clicked = -1;    // Returns clicked button from buttons list, 0 refers to closed window button
 
+    if (GuiIsClipped(bounds)) return clicked;
+
     int buttonsCount = 0;
     const char **buttonsText = GuiTextSplit(buttons, &buttonsCount, NULL);
     Rectangle buttonBounds = { 0 };
@@ -2834,7 +4081,7 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
     buttonBounds.width = (bounds.width - MESSAGEBOX_BUTTON_PADDING*(buttonsCount + 1))/buttonsCount;
     buttonBounds.height = MESSAGEBOX_BUTTON_HEIGHT;
 
-    Vector2 textSize = MeasureTextEx(guiFont, message, GuiGetStyle(DEFAULT, TEXT_SIZE), 1);
+    Vector2 textSize = GuiMeasureText(message, GuiGetStyle(DEFAULT, TEXT_SIZE), 1);
 
     Rectangle textBounds = { 0 };
     textBounds.x = bounds.x + bounds.width/2 - textSize.x/2;
@@ -2846,12 +4093,10 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
     //--------------------------------------------------------------------
     if (GuiWindowBox(bounds, title)) clicked = 0;
 
-    int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+    GuiPushStyle();
     GuiSetStyle(LABEL, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
     GuiLabel(textBounds, message);
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
 
-    prevTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
     GuiSetStyle(BUTTON, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
 
     for (int i = 0; i < buttonsCount; i++)
@@ -2860,7 +4105,7 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
         buttonBounds.x += (buttonBounds.width + MESSAGEBOX_BUTTON_PADDING);
     }
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, prevTextAlignment);
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return clicked;
@@ -2875,9 +4120,12 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
 
     #define TEXTINPUTBOX_MAX_TEXT_LENGTH   256
 
-    // Used to enable text edit mode
-    // WARNING: No more than one GuiTextInputBox() should be open at the same time
-    static bool textEditMode = false;
+    if (GuiIsClipped(bounds)) return -1;
+
+    // Used to enable text edit mode (kept per control)
+    unsigned int id = GuiGetIdPtr(text);
+    const bool *editState = (const bool *)GuiFindStateData(id);
+    bool textEditMode = (editState != NULL)? *editState : false;
 
     int btnIndex = -1;
 
@@ -2894,7 +4142,7 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
     Rectangle textBounds = { 0 };
     if (message != NULL)
     {
-        Vector2 textSize = MeasureTextEx(guiFont, message, GuiGetStyle(DEFAULT, TEXT_SIZE), 1);
+        Vector2 textSize = GuiMeasureText(message, GuiGetStyle(DEFAULT, TEXT_SIZE), 1);
 
         textBounds.x = bounds.x + bounds.width/2 - textSize.x/2;
         textBounds.y = bounds.y + WINDOW_STATUSBAR_HEIGHT + messageInputHeight/4 - textSize.y/2;
@@ -2917,15 +4165,22 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
     // Draw message if available
     if (message != NULL)
     {
-        int prevTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+        GuiPushStyle();
         GuiSetStyle(LABEL, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
         GuiLabel(textBounds, message);
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, prevTextAlignment);
+        GuiPopStyle();
     }
 
+    // NOTE: Text box shares text pointer, its id is got inside text input box id scope
+    GuiPushIdPtr(text);
     if (GuiTextBox(textBoxBounds, text, TEXTINPUTBOX_MAX_TEXT_LENGTH, textEditMode)) textEditMode = !textEditMode;
+    GuiPopId();
 
-    int prevBtnTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    // State is only kept while editing, no table entries for idle input boxes
+    if (textEditMode) *(bool *)GuiGetStateData(id) = true;
+    else GuiRemoveStateData(id);
+
+    GuiPushStyle();
     GuiSetStyle(BUTTON, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER);
 
     for (int i = 0; i < buttonsCount; i++)
@@ -2934,7 +4189,7 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
         buttonBounds.x += (buttonBounds.width + MESSAGEBOX_BUTTON_PADDING);
     }
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, prevBtnTextAlignment);
+    GuiPopStyle();
     //--------------------------------------------------------------------
 
     return btnIndex;
@@ -2954,6 +4209,8 @@ Vector2 GuiGrid(Rectangle bounds, float spacing, int subdivs)
     Vector2 mousePoint = GetMousePosition();
     Vector2 currentCell = { -1, -1 };
 
+    if (GuiIsClipped(bounds)) return currentCell;
+
     int linesV = ((int)(bounds.width/spacing))*subdivs + 1;
     int linesH = ((int)(bounds.height/spacing))*subdivs + 1;
 
@@ -2961,7 +4218,7 @@ Vector2 GuiGrid(Rectangle bounds, float spacing, int subdivs)
     //--------------------------------------------------------------------
     if ((state != GUI_STATE_DISABLED) && !guiLocked)
     {
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHitRec(mousePoint, bounds))
         {
             currentCell.x = (int)((mousePoint.x - bounds.x)/spacing);
             currentCell.y = (int)((mousePoint.y - bounds.y)/spacing);
@@ -2980,13 +4237,13 @@ Vector2 GuiGrid(Rectangle bounds, float spacing, int subdivs)
                 // Draw vertical grid lines
                 for (int i = 0; i < linesV; i++)
                 {
-                    DrawRectangleRec(RAYGUI_CLITERAL(Rectangle) { bounds.x + spacing * i / subdivs, bounds.y, 1, bounds.height }, ((i%subdivs) == 0) ? Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA * 4) : Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA));
+                    GuiDrawRectangleRec(RAYGUI_CLITERAL(Rectangle) { bounds.x + spacing * i / subdivs, bounds.y, 1, bounds.height }, ((i%subdivs) == 0) ? Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA * 4) : Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA));
                 }
 
                 // Draw horizontal grid lines
                 for (int i = 0; i < linesH; i++)
                 {
-                    DrawRectangleRec(RAYGUI_CLITERAL(Rectangle) { bounds.x, bounds.y + spacing * i / subdivs, bounds.width, 1 }, ((i%subdivs) == 0) ? Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA * 4) : Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA));
+                    GuiDrawRectangleRec(RAYGUI_CLITERAL(Rectangle) { bounds.x, bounds.y + spacing * i / subdivs, bounds.width, 1 }, ((i%subdivs) == 0) ? Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA * 4) : Fade(GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)), GRID_COLOR_ALPHA));
                 }
             }
         } break;
@@ -3001,270 +4258,347 @@ Vector2 GuiGrid(Rectangle bounds, float spacing, int subdivs)
 //----------------------------------------------------------------------------------
 
 // Load raygui style file (.rgs)
+// NOTE: File is read with a single bulk read, style data is parsed from memory
 void GuiLoadStyle(const char *fileName)
 {
-    bool tryBinary = false;
+    FILE *rgsFile = fopen(fileName, "rb");
 
-    // Try reading the files as text file first
-    FILE *rgsFile = fopen(fileName, "rt");
+    if (rgsFile == NULL) return;
 
-    if (rgsFile != NULL)
+    fseek(rgsFile, 0, SEEK_END);
+    long fileSize = ftell(rgsFile);
+    fseek(rgsFile, 0, SEEK_SET);
+
+    if ((fileSize > 0) && (fileSize < INT_MAX))
     {
-        char buffer[256] = { 0 };
-        fgets(buffer, 256, rgsFile);
+        // NOTE: One extra byte is allocated to NULL-terminate text style files
+        unsigned char *fileData = (unsigned char *)RAYGUI_MALLOC(fileSize + 1);
 
-        if (buffer[0] == '#')
+        if (fileData != NULL)
         {
-            int controlId = 0;
-            int propertyId = 0;
-            unsigned int propertyValue = 0;
-
-            while (!feof(rgsFile))
+            if (fread(fileData, 1, fileSize, rgsFile) == (size_t)fileSize)
             {
-                switch (buffer[0])
-                {
-                    case 'p':
-                    {
-                        // Style property: p <control_id> <property_id> <property_value> <property_name>
+                fileData[fileSize] = '\0';
+
+                // Text style files start with a comment line, binary ones with a signature
+                if (fileData[0] == '#') GuiLoadStyleText((const char *)fileData, fileName);
+                else GuiLoadStyleFromMemory(fileData, (int)fileSize);
+            }
 
-                        sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue);
+            RAYGUI_FREE(fileData);
+        }
+    }
 
-                        GuiSetStyle(controlId, propertyId, (int)propertyValue);
+    fclose(rgsFile);
+}
 
-                    } break;
-                    case 'f':
-                    {
-                        // Style font: f <gen_font_size> <charmap_file> <font_file>
+// Set style property value loaded from style data
+// NOTE: DEFAULT standard properties are propagated to all controls, invalid ids are ignored,
+// resolved colors and text measurements are not updated (done once after loading)
+static void GuiSetStyleLoaded(int control, int property, unsigned int value)
+{
+    if ((control < 0) || (control >= NUM_CONTROLS) || (property < 0) || (property >= (NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED))) return;
 
-                        int fontSize = 0;
-                        char charmapFileName[256] = { 0 };
-                        char fontFileName[256] = { 0 };
-                        sscanf(buffer, "f %d %s %[^\n]s", &fontSize, charmapFileName, fontFileName);
+    guiStyle[control*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property] = value;
 
-                        Font font = { 0 };
+    if ((control == 0) && (property < NUM_PROPS_DEFAULT))
+    {
+        for (int i = 1; i < NUM_CONTROLS; i++) guiStyle[i*(NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED) + property] = value;
+    }
+}
 
-                        if (charmapFileName[0] != '0')
-                        {
-                            // Load characters from charmap file,
-                            // expected '\n' separated list of integer values
-                            char *charValues = LoadText(charmapFileName);
-                            if (charValues != NULL)
-                            {
-                                int charsCount = 0;
-                                const char **chars = TextSplit(charValues, '\n', &charsCount);
+// Load style from text style data (.rgs text file), NULL-terminated
+// NOTE: fileName is only used to locate font files, relative to style file directory,
+// font is not loaded if fileName is NULL
+static void GuiLoadStyleText(const char *text, const char *fileName)
+{
+    const char *line = text;
+
+    while (*line != '\0')
+    {
+        const char *lineEnd = strchr(line, '\n');
+        if (lineEnd == NULL) lineEnd = line + strlen(line);
 
-                                int *values = (int *)RAYGUI_MALLOC(charsCount*sizeof(int));
-                                for (int i = 0; i < charsCount; i++) values[i] = TextToInteger(chars[i]);
+        switch (line[0])
+        {
+            case 'p':
+            {
+                // Style property: p <control_id> <property_id> <property_value> <property_name>
+                // NOTE: Parsed in place, numbers never span lines so parsing stops before lineEnd
+                char *end = NULL;
+                int controlId = (int)strtol(line + 1, &end, 10);
+                int propertyId = (int)strtol(end, &end, 10);
+                unsigned int propertyValue = (unsigned int)strtoul(end, &end, 16);
 
-                                font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, values, charsCount);
+                if (end <= lineEnd) GuiSetStyleLoaded(controlId, propertyId, propertyValue);
 
-                                RAYGUI_FREE(values);
-                            }
-                        }
-                        else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);
+            } break;
+            case 'f':
+            {
+                // Style font: f <gen_font_size> <charmap_file> <font_file>
+                if (fileName == NULL) break;
+
+                char buffer[256] = { 0 };
+                int lineLength = (int)(lineEnd - line);
+                memcpy(buffer, line, (lineLength < 255)? lineLength : 255);
+
+                int fontSize = 0;
+                char charmapFileName[256] = { 0 };
+                char fontFileName[256] = { 0 };
+                sscanf(buffer, "f %d %s %[^\n]s", &fontSize, charmapFileName, fontFileName);
+
+                Font font = { 0 };
+
+                if (charmapFileName[0] != '0')
+                {
+                    // Load characters from charmap file,
+                    // expected '\n' separated list of integer values
+                    char *charValues = LoadText(charmapFileName);
+                    if (charValues != NULL)
+                    {
+                        int charsCount = 0;
+                        const char **chars = TextSplit(charValues, '\n', &charsCount);
+
+                        int *values = (int *)RAYGUI_MALLOC(charsCount*sizeof(int));
 
-                        if ((font.texture.id > 0) && (font.charsCount > 0)) GuiSetFont(font);
+                        if (values != NULL)
+                        {
+                            for (int i = 0; i < charsCount; i++) values[i] = TextToInteger(chars[i]);
+
+                            font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, values, charsCount);
 
-                    } break;
-                    default: break;
+                            RAYGUI_FREE(values);
+                        }
+                    }
                 }
+                else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);
 
-                fgets(buffer, 256, rgsFile);
-            }
+                if ((font.texture.id > 0) && (font.charsCount > 0)) GuiSetFont(font);
+
+            } break;
+            default: break;
         }
-        else tryBinary = true;
 
-        fclose(rgsFile);
+        line = (*lineEnd == '\n')? lineEnd + 1 : lineEnd;
     }
 
-    if (tryBinary)
-    {
-        rgsFile = fopen(fileName, "rb");
+    GuiUpdateStyleColors();
+    GuiInvalidateTextMeasure();
+}
 
-        if (rgsFile == NULL) return;
+// Copy data block from style data, returns false if block is out of bounds
+static bool GuiReadStyleData(void *dst, int size, const unsigned char *data, int dataSize, int *offset)
+{
+    if ((size < 0) || (*offset > (dataSize - size))) return false;
 
-        char signature[5] = "";
-        short version = 0;
-        short reserved = 0;
+    memcpy(dst, data + *offset, size);
+    *offset += size;
+
+    return true;
+}
+
+// Load style properties from binary style data (.rgs binary file), font data is not loaded
+// NOTE: Returns data offset after properties data (font data), 0 if data is not valid
+static int GuiLoadStyleProperties(const unsigned char *fileData, int dataSize)
+{
+    if (dataSize < 12) return 0;
+
+    int offset = 12;
+    short version = 0;
+    memcpy(&version, fileData + 4, sizeof(short));
+
+    if (memcmp(fileData, "rGS ", 4) == 0)
+    {
         int propertiesCount = 0;
+        memcpy(&propertiesCount, fileData + 8, sizeof(int));
 
-        fread(signature, 1, 4, rgsFile);
-        fread(&version, 1, sizeof(short), rgsFile);
-        fread(&reserved, 1, sizeof(short), rgsFile);
-        fread(&propertiesCount, 1, sizeof(int), rgsFile);
+        if ((propertiesCount < 0) || (propertiesCount > (dataSize - offset)/8)) return 0;
 
-        if ((signature[0] == 'r') &&
-            (signature[1] == 'G') &&
-            (signature[2] == 'S') &&
-            (signature[3] == ' '))
+        for (int i = 0; i < propertiesCount; i++, offset += 8)
         {
             short controlId = 0;
             short propertyId = 0;
             int propertyValue = 0;
 
-            for (int i = 0; i < propertiesCount; i++)
-            {
-                fread(&controlId, 1, sizeof(short), rgsFile);
-                fread(&propertyId, 1, sizeof(short), rgsFile);
-                fread(&propertyValue, 1, sizeof(int), rgsFile);
+            memcpy(&controlId, fileData + offset, sizeof(short));
+            memcpy(&propertyId, fileData + offset + 2, sizeof(short));
+            memcpy(&propertyValue, fileData + offset + 4, sizeof(int));
 
-                if (controlId == 0) // DEFAULT control
-                {
-                    // If a DEFAULT property is loaded, it is propagated to all controls
-                    // NOTE: All DEFAULT properties should be defined first in the file
-                    GuiSetStyle(0, (int)propertyId, propertyValue);
+            GuiSetStyleLoaded(controlId, propertyId, (unsigned int)propertyValue);
+        }
+    }
+    else if (memcmp(fileData, "rGSP", 4) == 0)
+    {
+        short controlsCount = 0;
+        short propertiesCount = 0;
+        memcpy(&controlsCount, fileData + 8, sizeof(short));
+        memcpy(&propertiesCount, fileData + 10, sizeof(short));
 
-                    if (propertyId < NUM_PROPS_DEFAULT) for (int i = 1; i < NUM_CONTROLS; i++) GuiSetStyle(i, (int)propertyId, propertyValue);
-                }
-                else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
-            }
+        if ((version != 100) ||
+            (controlsCount != NUM_CONTROLS) ||
+            (propertiesCount != (NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED))) return 0;
+
+        if (!GuiReadStyleData(guiStyle, sizeof(guiStyle), fileData, dataSize, &offset)) return 0;
+    }
+    else return 0;
+
+    return offset;
+}
+
+// Load style from memory (binary .rgs file data)
+// NOTE: Header and blocks sizes are validated against data size, invalid data is ignored.
+// Font texture is created from font image data in place, fileData can be constant data
+// embedded in the program (check examples/style_compiler)
+void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
+{
+
+    // Style File Structure (.rgs), properties list layout
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGS "
+    // 4       | 2       | short      | Version: 200
+    // 6       | 2       | short      | reserved
+    // 8       | 4       | int        | Num properties (N)
+
+    // Properties data: Id-value pairs, DEFAULT ones first (propagated to all controls)
+    // foreach (property)
+    // {
+    //   12+8*i  | 2     | short      | ControlId
+    //   14+8*i  | 2     | short      | PropertyId
+    //   16+8*i  | 4     | int        | Property value
+    // }
+
+    // Style File Structure (.rgs), packed layout
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGSP"
+    // 4       | 2       | short      | Version: 100
+    // 6       | 2       | short      | reserved
+    // 8       | 2       | short      | Num controls (C), must be NUM_CONTROLS
+    // 10      | 2       | short      | Num properties per control (P), must be NUM_PROPS_DEFAULT + NUM_PROPS_EXTENDED
+
+    // Properties data: Full style table, same layout as context style array (copied as a whole)
+    // 12      | 4*C*P   | unsigned int | Property values
+
+    // Font data (both layouts), only loaded if not RAYGUI_STANDALONE
+    // ------------------------------------------------------
+    // ...     | 4       | int        | Font data size (0 if no font)
+    // ...     | 4       | int        | Font base size
+    // ...     | 4       | int        | Font chars count (K)
+    // ...     | 4       | int        | Font type (0-Normal, 1-SDF)
+    // ...     | 16      | Rectangle  | Font white rectangle
+    // ...     | 4       | int        | Font image data size (S)
+    // if (S > 0)
+    // {
+    //   ...   | 12      | int        | Font image width, height and format
+    //   ...   | S       | unsigned char | Font image data
+    // }
+    // ...     | 16*K    | Rectangle  | Font chars rectangles
+    // ...     | 16*K    | int        | Font chars info: value, offsetX, offsetY, advanceX
 
-            // Font loading is highly dependant on raylib API to load font data and image
-            // TODO: Find some mechanism to support it in standalone mode
+    int offset = GuiLoadStyleProperties(fileData, dataSize);
+
+    if (offset == 0) return;
+
+    GuiUpdateStyleColors();
+    GuiInvalidateTextMeasure();
+
+    // Font loading is highly dependant on raylib API to load font data and image
+    // TODO: Find some mechanism to support it in standalone mode
 #if !defined(RAYGUI_STANDALONE)
-            // Load custom font if available
-            int fontDataSize = 0;
-            fread(&fontDataSize, 1, sizeof(int), rgsFile);
+    // Load custom font if available
+    int fontDataSize = 0;
 
-            if (fontDataSize > 0)
-            {
-                Font font = { 0 };
-                int fontType = 0;   // 0-Normal, 1-SDF
-                Rectangle whiteRec = { 0 };
+    if (GuiReadStyleData(&fontDataSize, sizeof(int), fileData, dataSize, &offset) && (fontDataSize > 0))
+    {
+        Font font = { 0 };
+        int fontType = 0;   // 0-Normal, 1-SDF
+        Rectangle whiteRec = { 0 };
+        int fontImageSize = 0;
 
-                fread(&font.baseSize, 1, sizeof(int), rgsFile);
-                fread(&font.charsCount, 1, sizeof(int), rgsFile);
-                fread(&fontType, 1, sizeof(int), rgsFile);
+        Image imFont = { 0 };
+        imFont.mipmaps = 1;
 
-                // Load font white rectangle
-                fread(&whiteRec, 1, sizeof(Rectangle), rgsFile);
+        bool valid = GuiReadStyleData(&font.baseSize, sizeof(int), fileData, dataSize, &offset) &&
+                     GuiReadStyleData(&font.charsCount, sizeof(int), fileData, dataSize, &offset) &&
+                     GuiReadStyleData(&fontType, sizeof(int), fileData, dataSize, &offset) &&
+                     GuiReadStyleData(&whiteRec, sizeof(Rectangle), fileData, dataSize, &offset) &&
+                     GuiReadStyleData(&fontImageSize, sizeof(int), fileData, dataSize, &offset);
+
+        if (valid && (fontImageSize > 0))
+        {
+            valid = GuiReadStyleData(&imFont.width, sizeof(int), fileData, dataSize, &offset) &&
+                    GuiReadStyleData(&imFont.height, sizeof(int), fileData, dataSize, &offset) &&
+                    GuiReadStyleData(&imFont.format, sizeof(int), fileData, dataSize, &offset) &&
+                    (fontImageSize <= (dataSize - offset));
+        }
+        else if (fontImageSize < 0) valid = false;
 
-                // Load font image parameters
-                int fontImageSize = 0;
-                fread(&fontImageSize, 1, sizeof(int), rgsFile);
+        // Chars rectangles and info must be complete
+        if (valid) valid = (font.charsCount > 0) && (font.charsCount <= (dataSize - offset - fontImageSize)/(int)(sizeof(Rectangle) + 4*sizeof(int)));
 
-                if (fontImageSize > 0)
-                {
-                    Image imFont = { 0 };
-                    imFont.mipmaps = 1;
-                    fread(&imFont.width, 1, sizeof(int), rgsFile);
-                    fread(&imFont.height, 1, sizeof(int), rgsFile);
-                    fread(&imFont.format, 1, sizeof(int), rgsFile);
+        if (valid)
+        {
+            // NOTE: Font arrays are allocated first, on failure current font is kept
+            font.recs = (Rectangle *)RAYGUI_CALLOC(font.charsCount, sizeof(Rectangle));
+            font.chars = (CharInfo *)RAYGUI_CALLOC(font.charsCount, sizeof(CharInfo));
 
-                    imFont.data = (unsigned char *)RAYGUI_MALLOC(fontImageSize);
-                    fread(imFont.data, 1, fontImageSize, rgsFile);
+            if ((font.recs == NULL) || (font.chars == NULL))
+            {
+                RAYGUI_FREE(font.recs);
+                RAYGUI_FREE(font.chars);
+                valid = false;
+            }
+        }
 
-                    font.texture = LoadTextureFromImage(imFont);
+        if (valid)
+        {
+            if (fontImageSize > 0)
+            {
+                // NOTE: Texture is created from image data in place, no copy required
+                imFont.data = (void *)(fileData + offset);
+                offset += fontImageSize;
 
-                    UnloadImage(imFont);
-                }
+                font.texture = LoadTextureFromImage(imFont);
+            }
 
-                // Load font recs data
-                font.recs = (Rectangle *)RAYGUI_CALLOC(font.charsCount, sizeof(Rectangle));
-                for (int i = 0; i < font.charsCount; i++) fread(&font.recs[i], 1, sizeof(Rectangle), rgsFile);
+            // Load font recs data, copied as a whole
+            memcpy(font.recs, fileData + offset, font.charsCount*sizeof(Rectangle));
+            offset += font.charsCount*sizeof(Rectangle);
 
-                // Load font chars info data
-                font.chars = (CharInfo *)RAYGUI_CALLOC(font.charsCount, sizeof(CharInfo));
-                for (int i = 0; i < font.charsCount; i++)
-                {
-                    fread(&font.chars[i].value, 1, sizeof(int), rgsFile);
-                    fread(&font.chars[i].offsetX, 1, sizeof(int), rgsFile);
-                    fread(&font.chars[i].offsetY, 1, sizeof(int), rgsFile);
-                    fread(&font.chars[i].advanceX, 1, sizeof(int), rgsFile);
-                }
+            // Load font chars info data
+            // NOTE: CharInfo value, offsetX, offsetY and advanceX are contiguous ints
+            for (int i = 0; i < font.charsCount; i++, offset += 4*sizeof(int)) memcpy(&font.chars[i].value, fileData + offset, 4*sizeof(int));
 
+            if (font.texture.id > 0)
+            {
                 GuiSetFont(font);
 
                 // Set font texture source rectangle to be used as white texture to draw shapes
                 // NOTE: This way, all gui can be draw using a single draw call
                 if ((whiteRec.width != 0) && (whiteRec.height != 0)) SetShapesTexture(font.texture, whiteRec);
             }
-#endif
+            else
+            {
+                RAYGUI_FREE(font.recs);
+                RAYGUI_FREE(font.chars);
+            }
         }
-
-        fclose(rgsFile);
     }
-
-    guiStyleLoaded = true;
+#endif
 }
 
 // Load style default over global style
 void GuiLoadStyleDefault(void)
 {
-    // We set this variable first to avoid cyclic function calls
-    // when calling GuiSetStyle() and GuiGetStyle()
-    guiStyleLoaded = true;
-
-    // Initialize default LIGHT style property values
-    GuiSetStyle(DEFAULT, BORDER_COLOR_NORMAL, 0x838383ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_NORMAL, 0xc9c9c9ff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, 0x686868ff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_FOCUSED, 0x5bb2d9ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_FOCUSED, 0xc9effeff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_FOCUSED, 0x6c9bbcff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_PRESSED, 0x0492c7ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_PRESSED, 0x97e8ffff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_PRESSED, 0x368bafff);
-    GuiSetStyle(DEFAULT, BORDER_COLOR_DISABLED, 0xb5c1c2ff);
-    GuiSetStyle(DEFAULT, BASE_COLOR_DISABLED, 0xe6e9e9ff);
-    GuiSetStyle(DEFAULT, TEXT_COLOR_DISABLED, 0xaeb7b8ff);
-    GuiSetStyle(DEFAULT, BORDER_WIDTH, 1);                       // WARNING: Some controls use other values
-    GuiSetStyle(DEFAULT, TEXT_PADDING, 0);                       // WARNING: Some controls use other values
-    GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_CENTER); // WARNING: Some controls use other values
-
-    // Initialize control-specific property values
-    // NOTE: Those properties are in default list but require specific values by control type
-    GuiSetStyle(LABEL, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_LEFT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 2);
-    GuiSetStyle(SLIDER, TEXT_PADDING, 5);
-    GuiSetStyle(CHECKBOX, TEXT_PADDING, 5);
-    GuiSetStyle(CHECKBOX, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_RIGHT);
-    GuiSetStyle(TEXTBOX, TEXT_PADDING, 5);
-    GuiSetStyle(TEXTBOX, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_LEFT);
-    GuiSetStyle(VALUEBOX, TEXT_PADDING, 4);
-    GuiSetStyle(VALUEBOX, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_LEFT);
-    GuiSetStyle(SPINNER, TEXT_PADDING, 4);
-    GuiSetStyle(SPINNER, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_LEFT);
-    GuiSetStyle(STATUSBAR, TEXT_PADDING, 6);
-    GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, GUI_TEXT_ALIGN_LEFT);
-
-    // Initialize extended property values
-    // NOTE: By default, extended property values are initialized to 0
-    GuiSetStyle(DEFAULT, TEXT_SIZE, 10);                // DEFAULT, shared by all controls
-    GuiSetStyle(DEFAULT, TEXT_SPACING, 1);              // DEFAULT, shared by all controls
-    GuiSetStyle(DEFAULT, LINE_COLOR, 0x90abb5ff);       // DEFAULT specific property
-    GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0xf5f5f5ff); // DEFAULT specific property
-    GuiSetStyle(TOGGLE, GROUP_PADDING, 2);
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, 15);
-    GuiSetStyle(SLIDER, SLIDER_PADDING, 1);
-    GuiSetStyle(PROGRESSBAR, PROGRESS_PADDING, 1);
-    GuiSetStyle(CHECKBOX, CHECK_PADDING, 1);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_WIDTH, 30);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_PADDING, 2);
-    GuiSetStyle(DROPDOWNBOX, ARROW_PADDING, 16);
-    GuiSetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_PADDING, 2);
-    GuiSetStyle(TEXTBOX, TEXT_LINES_PADDING, 5);
-    GuiSetStyle(TEXTBOX, TEXT_INNER_PADDING, 4);
-    GuiSetStyle(TEXTBOX, COLOR_SELECTED_FG, 0xf0fffeff);
-    GuiSetStyle(TEXTBOX, COLOR_SELECTED_BG, 0x839affe0);
-    GuiSetStyle(SPINNER, SPIN_BUTTON_WIDTH, 20);
-    GuiSetStyle(SPINNER, SPIN_BUTTON_PADDING, 2);
-    GuiSetStyle(SCROLLBAR, BORDER_WIDTH, 0);
-    GuiSetStyle(SCROLLBAR, ARROWS_VISIBLE, 0);
-    GuiSetStyle(SCROLLBAR, ARROWS_SIZE, 6);
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_PADDING, 0);
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, 16);
-    GuiSetStyle(SCROLLBAR, SCROLL_PADDING, 0);
-    GuiSetStyle(SCROLLBAR, SCROLL_SPEED, 10);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_HEIGHT, 0x1e);
-    GuiSetStyle(LISTVIEW, LIST_ITEMS_PADDING, 2);
-    GuiSetStyle(LISTVIEW, SCROLLBAR_WIDTH, 10);
-    GuiSetStyle(LISTVIEW, SCROLLBAR_SIDE, SCROLLBAR_RIGHT_SIDE);
-    GuiSetStyle(COLORPICKER, COLOR_SELECTOR_SIZE, 6);
-    GuiSetStyle(COLORPICKER, HUEBAR_WIDTH, 0x14);
-    GuiSetStyle(COLORPICKER, HUEBAR_PADDING, 0xa);
-    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT, 6);
-    GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW, 2);
+    // NOTE: Default style is constant data (see RAYGUI_STYLE_DEFAULT_ROWS),
+    // it is copied as a whole, including extended property values
+    memcpy(guiStyle, guiStyleDefault, sizeof(guiStyleDefault));
+
+    GuiUpdateStyleColors();
+    GuiInvalidateTextMeasure();
 }
 
 // Get text with icon id prepended
@@ -3273,19 +4607,16 @@ void GuiLoadStyleDefault(void)
 const char *GuiIconText(int iconId, const char *text, int maxLength)
 {
 #if defined(RAYGUI_SUPPORT_ICONS)
-    static char buffer[1024] = { 0 };
-    memset(buffer, 0, 1024);
+    int length = 0;
+    if (text != NULL) while ((length < maxLength) && (text[length] != '\0')) length++;
 
-    sprintf(buffer, "#%03i#", iconId);
+    // NOTE: Result is allocated from scratch arena, valid until scratch arena reset
+    char *buffer = (char *)GuiScratchAlloc(length + 6);
+    if (buffer == NULL) return "";
 
-    if (text != NULL)
-    {
-        for (int i = 5; (i < 1024) && (i < (maxLength + 5)); i++)
-        {
-            buffer[i] = text[i - 5];
-            if (text[i - 5] == '\0') break;
-        }
-    }
+    snprintf(buffer, 6, "#%03i#", iconId);
+    if (length > 0) memcpy(buffer + 5, text, length);
+    buffer[length + 5] = '\0';
 
     return buffer;
 #else
@@ -3296,6 +4627,7 @@ const char *GuiIconText(int iconId, const char *text, int maxLength)
 #if defined(RAYGUI_SUPPORT_ICONS)
 
 // Get full icons data pointer
+// NOTE: Icons modified directly on this array are not re-baked into icons atlas, use GuiSetIconData()
 unsigned int *GuiGetIcons(void) { return guiIcons; }
 
 // Load raygui icons file (.rgi)
@@ -3360,9 +4692,15 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
                     fread(guiIconsName[i], 32, 1, rgiFile);
                 }
             }
+            else fseek(rgiFile, iconsCount*32, SEEK_CUR);     // Skip icons name ids
 
             // Read icons data directly over guiIcons data array
             fread(guiIcons, iconsCount*(iconsSize*iconsSize/32), sizeof(unsigned int), rgiFile);
+
+            // Loaded icons must be re-baked into icons atlas
+            for (int i = 0; (i < iconsCount) && (i < RICON_MAX_ICONS); i++) guiIconsDirty[i] = true;
+            guiIconsAtlasDirty = true;
+            guiIconsVersion++;
         }
     
         fclose(rgiFile);
@@ -3371,32 +4709,40 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
     return guiIconsName;
 }
 
-// Draw selected icon using rectangles pixel-by-pixel
+// Draw selected icon
+// NOTE: Icon is drawn as a single quad from icons atlas texture,
+// in standalone mode (no textures support) icon pixel runs are drawn as rectangles
 void GuiDrawIcon(int iconId, Vector2 position, int pixelSize, Color color)
 {
-    #define BIT_CHECK(a,b) ((a) & (1<<(b)))
+    if ((iconId < 0) || (iconId >= RICON_MAX_ICONS)) return;
 
-    for (int i = 0, y = 0; i < RICON_SIZE*RICON_SIZE/32; i++)
+    if (guiDrawListActive)
     {
-        for (int k = 0; k < 32; k++)
-        {
-            if (BIT_CHECK(guiIcons[iconId*RICON_DATA_ELEMENTS + i], k))
-            {
-            #if !defined(RAYGUI_STANDALONE)
-                DrawRectangle(position.x + (k%RICON_SIZE)*pixelSize, position.y + y*pixelSize, pixelSize, pixelSize, color);
-            #endif
-            }
-            
-            if ((k == 15) || (k == 31)) y++;
-        }
+        GuiDrawCommand *cmd = GuiPushDrawCommand(GUI_DRAWCMD_ICON, RAYGUI_CLITERAL(Rectangle){ position.x, position.y, (float)RICON_SIZE*pixelSize, (float)RICON_SIZE*pixelSize }, color);
+        cmd->data.icon.iconId = iconId;
+        cmd->data.icon.pixelSize = pixelSize;
+        return;
+    }
+
+#if !defined(RAYGUI_STANDALONE)
+    if (GuiUpdateIconsAtlas())
+    {
+        Rectangle source = { (float)((iconId%RICON_ATLAS_COLUMNS)*RICON_SIZE), (float)((iconId/RICON_ATLAS_COLUMNS)*RICON_SIZE), (float)RICON_SIZE, (float)RICON_SIZE };
+        Rectangle dest = { (float)((int)position.x), (float)((int)position.y), (float)RICON_SIZE*pixelSize, (float)RICON_SIZE*pixelSize };
+
+        DrawTexturePro(guiIconsAtlas, source, dest, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, color);
     }
+    else GuiDrawIconPixels(iconId, position, pixelSize, color);  // Icons atlas could not be created
+#else
+    GuiDrawIconPixels(iconId, position, pixelSize, color);
+#endif
 }
 
 // Get icon bit data
 // NOTE: Bit data array grouped as unsigned int (ICON_SIZE*ICON_SIZE/32 elements)
 unsigned int *GuiGetIconData(int iconId)
 {
-    static unsigned int iconData[RICON_DATA_ELEMENTS] = { 0 };
+    unsigned int *iconData = guiCtx->iconData;
     memset(iconData, 0, RICON_DATA_ELEMENTS*sizeof(unsigned int));
 
     if (iconId < RICON_MAX_ICONS) memcpy(iconData, &guiIcons[iconId*RICON_DATA_ELEMENTS], RICON_DATA_ELEMENTS*sizeof(unsigned int));
@@ -3408,35 +4754,51 @@ unsigned int *GuiGetIconData(int iconId)
 // NOTE: Data must be provided as unsigned int array (ICON_SIZE*ICON_SIZE/32 elements)
 void GuiSetIconData(int iconId, unsigned int *data)
 {
-    if (iconId < RICON_MAX_ICONS) memcpy(&guiIcons[iconId*RICON_DATA_ELEMENTS], data, RICON_DATA_ELEMENTS*sizeof(unsigned int));
+    if (iconId < RICON_MAX_ICONS)
+    {
+        memcpy(&guiIcons[iconId*RICON_DATA_ELEMENTS], data, RICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+        guiIconsDirty[iconId] = true;
+        guiIconsAtlasDirty = true;
+        guiIconsVersion++;
+    }
 }
 
 // Set icon pixel value
 void GuiSetIconPixel(int iconId, int x, int y)
 {
-    #define BIT_SET(a,b)   ((a) |= (1<<(b)))
+    #define BIT_SET(a,b)   ((a) |= (1u<<(b)))
     
     // This logic works for any RICON_SIZE pixels icons,
     // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
     BIT_SET(guiIcons[iconId*RICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RICON_SIZE)*RICON_SIZE));
+
+    guiIconsDirty[iconId] = true;
+    guiIconsAtlasDirty = true;
+    guiIconsVersion++;
 }
 
 // Clear icon pixel value
 void GuiClearIconPixel(int iconId, int x, int y)
 {
-    #define BIT_CLEAR(a,b) ((a) &= ~((1)<<(b)))
+    #define BIT_CLEAR(a,b) ((a) &= ~((1u)<<(b)))
 
     // This logic works for any RICON_SIZE pixels icons,
     // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
     BIT_CLEAR(guiIcons[iconId*RICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RICON_SIZE)*RICON_SIZE));
+
+    guiIconsDirty[iconId] = true;
+    guiIconsAtlasDirty = true;
+    guiIconsVersion++;
 }
 
 // Check icon pixel value 
 bool GuiCheckIconPixel(int iconId, int x, int y)
 {
-    #define BIT_CHECK(a,b) ((a) & (1<<(b)))
+    #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
 
-    return (BIT_CHECK(guiIcons[iconId*8 + y/2], x + (y%2*16)));
+    // NOTE: Same data layout as GuiSetIconPixel(), works for any RICON_SIZE pixels icons
+    return (BIT_CHECK(guiIcons[iconId*RICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RICON_SIZE)*RICON_SIZE)));
 }
 #endif      // RAYGUI_SUPPORT_ICONS
 
@@ -3446,55 +4808,56 @@ bool GuiCheckIconPixel(int iconId, int x, int y)
 
 // Split controls text into multiple strings
 // Also check for multiple columns (required by GuiToggleGroup())
-const char **GuiTextSplit(const char *text, int *count, int *textRow)
+const char **GuiTextSplit(const char *text, int *count, int **textRows)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
-    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
-    //      1. Maximum number of possible split strings is set by TEXTSPLIT_MAX_TEXT_ELEMENTS
-    //      2. Maximum size of text to split is TEXTSPLIT_MAX_TEXT_LENGTH
-    // NOTE: Those definitions could be externally provided if required
-
-    #if !defined(TEXTSPLIT_MAX_TEXT_LENGTH)
-        #define TEXTSPLIT_MAX_TEXT_LENGTH      1024
-    #endif
-
-    #if !defined(TEXTSPLIT_MAX_TEXT_ELEMENTS)
-        #define TEXTSPLIT_MAX_TEXT_ELEMENTS     128
-    #endif
+    // inserted between strings delimited by ';' or '\n'. Strings pointers, rows (optional) and text copy
+    // are allocated from the scratch arena in a single block, so there are no limits on text length
+    // or number of strings; results are valid until scratch arena reset (check GuiScratchAlloc())
+    static const char *emptyResult[1] = { "" };   // Returned on allocation failure
+    static int emptyRows[1] = { 0 };
 
-    static const char *result[TEXTSPLIT_MAX_TEXT_ELEMENTS] = { NULL };
-    static char buffer[TEXTSPLIT_MAX_TEXT_LENGTH] = { 0 };
-    memset(buffer, 0, TEXTSPLIT_MAX_TEXT_LENGTH);
+    if (text == NULL) text = "";
 
-    result[0] = buffer;
+    // Count how many substrings we have on text
+    int length = 0;
     int counter = 1;
+    for (; text[length] != '\0'; length++) if ((text[length] == ';') || (text[length] == '\n')) counter++;
 
-    if (textRow != NULL) textRow[0] = 0;
+    int rowsSize = (textRows != NULL)? counter*(int)sizeof(int) : 0;
+    unsigned char *memory = (unsigned char *)GuiScratchAlloc(counter*(int)sizeof(const char *) + rowsSize + length + 1);
 
-    // Count how many substrings we have on text and point to every one
-    for (int i = 0; i < TEXTSPLIT_MAX_TEXT_LENGTH; i++)
+    if (memory == NULL)
     {
-        buffer[i] = text[i];
-        if (buffer[i] == '\0') break;
-        else if ((buffer[i] == ';') || (buffer[i] == '\n'))
-        {
-            result[counter] = buffer + i + 1;
+        *count = 1;
+        if (textRows != NULL) *textRows = emptyRows;
+        return emptyResult;
+    }
 
-            if (textRow != NULL)
-            {
-                if (buffer[i] == '\n') textRow[counter] = textRow[counter - 1] + 1;
-                else textRow[counter] = textRow[counter - 1];
-            }
+    const char **result = (const char **)memory;
+    int *rows = (int *)(memory + counter*sizeof(const char *));
+    char *buffer = (char *)(memory + counter*sizeof(const char *) + rowsSize);
 
-            buffer[i] = '\0';   // Set an end of string at this point
+    memcpy(buffer, text, length + 1);
+
+    result[0] = buffer;
+    if (textRows != NULL) rows[0] = 0;
 
-            counter++;
-            if (counter == TEXTSPLIT_MAX_TEXT_ELEMENTS) break;
+    // Point to every substring, check rows
+    for (int i = 0, k = 1; i < length; i++)
+    {
+        if ((buffer[i] == ';') || (buffer[i] == '\n'))
+        {
+            result[k] = buffer + i + 1;
+            if (textRows != NULL) rows[k] = rows[k - 1] + ((buffer[i] == '\n')? 1 : 0);
+
+            buffer[i] = '\0';   // Set an end of string at this point
+            k++;
         }
     }
 
     *count = counter;
+    if (textRows != NULL) *textRows = rows;
 
     return result;
 }
@@ -3623,11 +4986,671 @@ static Vector3 ConvertHSVtoRGB(Vector3 hsv)
     return rgb;
 }
 
-#if defined(RAYGUI_STANDALONE)
-// Returns a Color struct from hexadecimal value
-static Color GetColor(int hexValue)
+// Draw List View item
+static void GuiDrawListViewItem(Rectangle itemBounds, const char *text, GuiControlState state, bool selected, bool focused)
 {
-    Color color;
+    if (state == GUI_STATE_DISABLED)
+    {
+        if (selected)
+        {
+            GuiDrawRectangleRec(itemBounds, GuiGetStyleColor(LISTVIEW, BASE_COLOR_DISABLED));
+            GuiDrawRectangleLinesEx(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER_COLOR_DISABLED));
+        }
+
+        GuiDrawText(text, GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_DISABLED));
+    }
+    else
+    {
+        if (selected)
+        {
+            // Draw item selected
+            GuiDrawRectangleRec(itemBounds, GuiGetStyleColor(LISTVIEW, BASE_COLOR_PRESSED));
+            GuiDrawRectangleLinesEx(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER_COLOR_PRESSED));
+            GuiDrawText(text, GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_PRESSED));
+        }
+        else if (focused)
+        {
+            // Draw item focused
+            GuiDrawRectangleRec(itemBounds, GuiGetStyleColor(LISTVIEW, BASE_COLOR_FOCUSED));
+            GuiDrawRectangleLinesEx(itemBounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GuiGetStyleColor(LISTVIEW, BORDER_COLOR_FOCUSED));
+            GuiDrawText(text, GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_FOCUSED));
+        }
+        else
+        {
+            // Draw item normal
+            GuiDrawText(text, GetTextBounds(DEFAULT, itemBounds), GuiGetStyle(LISTVIEW, TEXT_ALIGNMENT), GuiGetStyleColor(LISTVIEW, TEXT_COLOR_NORMAL));
+        }
+    }
+}
+
+// Add new command to frame draw list
+// NOTE: Commands array grows as required, it's kept between frames
+static GuiDrawCommand *GuiPushDrawCommand(int type, Rectangle rec, Color color)
+{
+    if (guiDrawCommandsCount >= guiDrawCommandsCapacity)
+    {
+        int capacity = (guiDrawCommandsCapacity == 0)? 256 : guiDrawCommandsCapacity*2;
+        GuiDrawCommand *commands = (GuiDrawCommand *)RAYGUI_REALLOC(guiDrawCommands, capacity*sizeof(GuiDrawCommand));
+
+        if (commands != NULL)
+        {
+            guiDrawCommands = commands;
+            guiDrawCommandsCapacity = capacity;
+        }
+    }
+
+    // On allocation failure, command is recorded into a discarded one
+    GuiDrawCommand *cmd = (guiDrawCommandsCount < guiDrawCommandsCapacity)? &guiDrawCommands[guiDrawCommandsCount++] : &guiCtx->drawCommandDiscarded;
+    memset(cmd, 0, sizeof(GuiDrawCommand));
+
+    cmd->type = type;
+    cmd->rec = rec;
+    cmd->color[0] = color;
+
+    return cmd;
+}
+
+// Compute draw command visual hash (FNV-1a)
+// NOTE: Text commands hash text content (not storage pointer), gui font is also considered
+static unsigned int GuiHashDrawCommand(const GuiDrawCommand *cmd)
+{
+    #define HASH_BYTES(hash, data, size) { const unsigned char *bytes = (const unsigned char *)(data); \
+        for (int b = 0; b < (int)(size); b++) { hash ^= bytes[b]; hash *= 16777619u; } }
+
+    unsigned int hash = 2166136261u;
+    GuiDrawCommand copy = { 0 };
+    memcpy(&copy, cmd, sizeof(GuiDrawCommand));     // Keep padding bytes as recorded
+
+    if ((cmd->type == GUI_DRAWCMD_TEXT) || (cmd->type == GUI_DRAWCMD_TEXT_REC))
+    {
+        HASH_BYTES(hash, cmd->data.text.text, strlen(cmd->data.text.text));
+        HASH_BYTES(hash, &guiFont.texture.id, sizeof(guiFont.texture.id));
+        copy.data.text.text = NULL;
+    }
+#if defined(RAYGUI_SUPPORT_ICONS)
+    else if (cmd->type == GUI_DRAWCMD_ICON) HASH_BYTES(hash, &guiIconsVersion, sizeof(guiIconsVersion));
+#endif
+
+    // NOTE: Commands are zero-initialized on recording, padding bytes are deterministic
+    HASH_BYTES(hash, &copy, sizeof(GuiDrawCommand));
+
+    return hash;
+}
+
+// Compute draw commands list signature
+// NOTE: If drawn array is provided, commands hashes and bounds are stored sorted by hash (skipped commands not included)
+static unsigned int GuiHashDrawCommands(const GuiDrawCommand *commands, int count, GuiDrawnCommand *drawn)
+{
+    unsigned int hash = 2166136261u;
+    int drawnCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (commands[i].type == GUI_DRAWCMD_NONE) continue;
+
+        unsigned int cmdHash = GuiHashDrawCommand(&commands[i]);
+
+        if (drawn != NULL)
+        {
+            drawn[drawnCount].hash = cmdHash;
+            drawn[drawnCount].rec = commands[i].rec;
+            drawnCount++;
+        }
+
+        hash ^= cmdHash;
+        hash *= 16777619u;
+    }
+
+    hash ^= (unsigned int)count;
+
+    if (drawn != NULL) qsort(drawn, drawnCount, sizeof(GuiDrawnCommand), GuiCompareDrawnCommands);
+
+    return hash;
+}
+
+// Compare drawn commands by hash, required by qsort()
+static int GuiCompareDrawnCommands(const void *a, const void *b)
+{
+    unsigned int hashA = ((const GuiDrawnCommand *)a)->hash;
+    unsigned int hashB = ((const GuiDrawnCommand *)b)->hash;
+
+    return (hashA > hashB) - (hashA < hashB);
+}
+
+// Reserve drawn/frame commands arrays
+static bool GuiReserveDrawnCommands(int count)
+{
+    if (count > guiCtx->drawnCommandsCapacity)
+    {
+        int capacity = (count > 2*guiCtx->drawnCommandsCapacity)? count : 2*guiCtx->drawnCommandsCapacity;
+
+        GuiDrawnCommand *drawn = (GuiDrawnCommand *)RAYGUI_REALLOC(guiCtx->drawnCommands, capacity*sizeof(GuiDrawnCommand));
+        if (drawn == NULL) return false;
+        guiCtx->drawnCommands = drawn;
+
+        GuiDrawnCommand *frame = (GuiDrawnCommand *)RAYGUI_REALLOC(guiCtx->frameCommands, capacity*sizeof(GuiDrawnCommand));
+        if (frame == NULL) return false;
+        guiCtx->frameCommands = frame;
+
+        guiCtx->drawnCommandsCapacity = capacity;
+    }
+
+    return true;
+}
+
+// Add dirty rectangle merging overlapped ones
+// NOTE: Rectangle is rounded to pixels, if maximum count is reached it's merged with the rectangle that grows less
+static int GuiAddDirtyRect(Rectangle *rects, int count, Rectangle rec)
+{
+    if ((rec.width <= 0) || (rec.height <= 0)) return count;
+
+    // Round rectangle outwards to pixels
+    int left = (int)rec.x, top = (int)rec.y;
+    int right = (int)(rec.x + rec.width), bottom = (int)(rec.y + rec.height);
+    if ((float)left > rec.x) left--;
+    if ((float)top > rec.y) top--;
+    if ((float)right < (rec.x + rec.width)) right++;
+    if ((float)bottom < (rec.y + rec.height)) bottom++;
+
+    float x1 = (float)left, y1 = (float)top, x2 = (float)right, y2 = (float)bottom;
+
+    while (true)
+    {
+        int merge = -1;
+
+        // Look for an overlapped (or adjacent) rectangle
+        for (int i = 0; i < count; i++)
+        {
+            if ((x1 <= (rects[i].x + rects[i].width)) && (x2 >= rects[i].x) && (y1 <= (rects[i].y + rects[i].height)) && (y2 >= rects[i].y)) { merge = i; break; }
+        }
+
+        // No overlap and no room left, look for the rectangle that grows less on merging
+        if ((merge == -1) && (count == DIRTYRECTS_MAX_COUNT))
+        {
+            float minGrowth = 0.0f;
+
+            for (int i = 0; i < count; i++)
+            {
+                float ux1 = (x1 < rects[i].x)? x1 : rects[i].x;
+                float uy1 = (y1 < rects[i].y)? y1 : rects[i].y;
+                float ux2 = (x2 > (rects[i].x + rects[i].width))? x2 : (rects[i].x + rects[i].width);
+                float uy2 = (y2 > (rects[i].y + rects[i].height))? y2 : (rects[i].y + rects[i].height);
+                float growth = (ux2 - ux1)*(uy2 - uy1) - rects[i].width*rects[i].height;
+
+                if ((merge == -1) || (growth < minGrowth)) { merge = i; minGrowth = growth; }
+            }
+        }
+
+        if (merge == -1) break;
+
+        // Merge rectangle and check again (union could overlap other rectangles)
+        if (rects[merge].x < x1) x1 = rects[merge].x;
+        if (rects[merge].y < y1) y1 = rects[merge].y;
+        if ((rects[merge].x + rects[merge].width) > x2) x2 = rects[merge].x + rects[merge].width;
+        if ((rects[merge].y + rects[merge].height) > y2) y2 = rects[merge].y + rects[merge].height;
+
+        rects[merge] = rects[--count];
+    }
+
+    rects[count] = RAYGUI_CLITERAL(Rectangle){ x1, y1, x2 - x1, y2 - y1 };
+
+    return count + 1;
+}
+
+// Copy text into frame text storage
+// NOTE: Storage blocks are never moved, returned pointer is valid until next frame
+static const char *GuiPushDrawText(const char *text)
+{
+    int size = (int)strlen(text) + 1;
+
+    GuiTextBlock *block = guiDrawTextBlocks;
+    while ((block != NULL) && ((block->size - block->used) < size)) block = block->next;
+
+    if (block == NULL)
+    {
+        int blockSize = (size > DRAWLIST_TEXT_BLOCK_SIZE)? size : DRAWLIST_TEXT_BLOCK_SIZE;
+
+        block = (GuiTextBlock *)RAYGUI_MALLOC(sizeof(GuiTextBlock));
+        if (block == NULL) return "";
+
+        block->data = (char *)RAYGUI_MALLOC(blockSize);
+        if (block->data == NULL) { RAYGUI_FREE(block); return ""; }
+
+        block->size = blockSize;
+        block->used = 0;
+        block->next = guiDrawTextBlocks;
+        guiDrawTextBlocks = block;
+    }
+
+    char *copy = block->data + block->used;
+    memcpy(copy, text, size);
+    block->used += size;
+
+    return copy;
+}
+
+// Allocate memory from scratch arena (aligned to pointer size), returns NULL on allocation failure
+// NOTE: Allocations are released all at once by GuiResetScratch() at frame boundary, arena grows
+// by new blocks until then; if no reset point is ever reached, arena is reused from start once
+// SCRATCH_ARENA_MAX_SIZE bytes are used (results remain valid until that amount is consumed)
+static void *GuiScratchAlloc(int size)
+{
+    size = (size + (int)sizeof(void *) - 1) & ~((int)sizeof(void *) - 1);
+
+    GuiScratchBlock *block = guiCtx->scratchCurrent;
+    while ((block != NULL) && ((block->size - block->used) < size)) block = block->next;
+
+    if ((block == NULL) && !guiDrawListActive && (guiCtx->scratchUsed > 0) && ((guiCtx->scratchUsed + size) > SCRATCH_ARENA_MAX_SIZE))
+    {
+        GuiResetScratch();
+
+        block = guiCtx->scratchBlocks;
+        while ((block != NULL) && ((block->size - block->used) < size)) block = block->next;
+    }
+
+    if (block == NULL)
+    {
+        int blockSize = (size > SCRATCH_ARENA_BLOCK_SIZE)? size : SCRATCH_ARENA_BLOCK_SIZE;
+
+        block = (GuiScratchBlock *)RAYGUI_MALLOC(sizeof(GuiScratchBlock));
+        if (block == NULL) return NULL;
+
+        block->data = (unsigned char *)RAYGUI_MALLOC(blockSize);
+        if (block->data == NULL) { RAYGUI_FREE(block); return NULL; }
+
+        block->size = blockSize;
+        block->used = 0;
+        block->next = NULL;
+
+        // New blocks are appended, allocation order is kept for reuse after reset
+        GuiScratchBlock **last = &guiCtx->scratchBlocks;
+        while (*last != NULL) last = &(*last)->next;
+        *last = block;
+    }
+
+    void *ptr = block->data + block->used;
+    block->used += size;
+
+    guiCtx->scratchCurrent = block;
+    guiCtx->scratchUsed += size;
+    if (guiCtx->scratchUsed > guiCtx->scratchHighWater) guiCtx->scratchHighWater = guiCtx->scratchUsed;
+
+    return ptr;
+}
+
+// Register control bounds for hit testing and check if point is over it, not overlapped by controls drawn later
+static bool GuiCheckHitRec(Vector2 point, Rectangle bounds) { return GuiCheckHitRecEx(point, bounds, false); }
+
+// Register control bounds for hit testing and check if point is over it, not overlapped by controls drawn later
+// NOTE: Topmost control under point is resolved once per frame (first check), scanning previous frame
+// bounds from the last drawn one; controls checked before topmost bounds are registered do not react.
+// Bounds are compared (not registration order) so controls added or removed between frames are supported.
+// Container controls (drawing inner controls after their own checks) are also over point when topmost
+// bounds are inside them, inner controls still resolve which one reacts
+static bool GuiCheckHitRecEx(Vector2 point, Rectangle bounds, bool container)
+{
+    bounds = GuiClipRec(bounds);    // Only visible part of control reacts (and overlaps controls below)
+
+    bool hit = CheckCollisionPointRec(point, bounds);
+
+    if (guiCtx->hitTestActive)
+    {
+        if (guiCtx->hitRectsCount >= guiCtx->hitRectsCapacity)
+        {
+            int capacity = (guiCtx->hitRectsCapacity == 0)? 64 : guiCtx->hitRectsCapacity*2;
+            Rectangle *rects = (Rectangle *)RAYGUI_REALLOC(guiCtx->hitRects, capacity*sizeof(Rectangle));
+
+            if (rects != NULL)
+            {
+                guiCtx->hitRects = rects;
+                guiCtx->hitRectsCapacity = capacity;
+            }
+        }
+
+        if (guiCtx->hitRectsCount < guiCtx->hitRectsCapacity) guiCtx->hitRects[guiCtx->hitRectsCount++] = bounds;
+        else guiCtx->hitRectsDiscarded = true;
+
+        if (hit)
+        {
+            if (guiCtx->hitTopmostState == GUI_HIT_UNRESOLVED)
+            {
+                guiCtx->hitTopmostState = GUI_HIT_PASSED;
+
+                for (int i = guiCtx->hitRectsPrevCount - 1; i >= 0; i--)
+                {
+                    if (CheckCollisionPointRec(point, guiCtx->hitRectsPrev[i]))
+                    {
+                        guiCtx->hitTopmost = guiCtx->hitRectsPrev[i];
+                        guiCtx->hitTopmostState = GUI_HIT_BLOCKED;
+                        break;
+                    }
+                }
+            }
+
+            if (guiCtx->hitTopmostState == GUI_HIT_BLOCKED)
+            {
+                if ((bounds.x == guiCtx->hitTopmost.x) && (bounds.y == guiCtx->hitTopmost.y) &&
+                    (bounds.width == guiCtx->hitTopmost.width) && (bounds.height == guiCtx->hitTopmost.height)) guiCtx->hitTopmostState = GUI_HIT_PASSED;
+                else if (!container || (guiCtx->hitTopmost.x < bounds.x) || (guiCtx->hitTopmost.y < bounds.y) ||
+                    ((guiCtx->hitTopmost.x + guiCtx->hitTopmost.width) > (bounds.x + bounds.width)) ||
+                    ((guiCtx->hitTopmost.y + guiCtx->hitTopmost.height) > (bounds.y + bounds.height))) hit = false;
+            }
+        }
+    }
+
+    return hit;
+}
+
+// Compute control id hash (FNV-1a) from scope seed
+static unsigned int GuiHashId(unsigned int seed, const void *data, int size)
+{
+    unsigned int hash = seed;
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++) hash = (hash ^ bytes[i])*16777619u;
+
+    return (hash == 0)? 1 : hash;   // Id 0 is reserved for empty state table entries
+}
+
+// Find control state data, NULL if control id has no state (no entry is added)
+static void *GuiFindStateData(unsigned int id)
+{
+    if (guiCtx->stateEntriesCapacity == 0) return NULL;
+
+    unsigned int mask = guiCtx->stateEntriesCapacity - 1;
+
+    for (unsigned int i = id & mask; guiCtx->stateEntries[i].id != 0; i = (i + 1) & mask)
+    {
+        if (guiCtx->stateEntries[i].id == id) return &guiCtx->stateEntries[i].data;
+    }
+
+    return NULL;
+}
+
+// Resize control state table, entries are rehashed
+static bool GuiResizeStateTable(int capacity)
+{
+    GuiStateEntry *entries = (GuiStateEntry *)RAYGUI_CALLOC(capacity, sizeof(GuiStateEntry));
+    if (entries == NULL) return false;
+
+    unsigned int mask = capacity - 1;
+
+    for (int i = 0; i < guiCtx->stateEntriesCapacity; i++)
+    {
+        if (guiCtx->stateEntries[i].id == 0) continue;
+
+        unsigned int k = guiCtx->stateEntries[i].id & mask;
+        while (entries[k].id != 0) k = (k + 1) & mask;
+
+        entries[k] = guiCtx->stateEntries[i];
+    }
+
+    RAYGUI_FREE(guiCtx->stateEntries);
+    guiCtx->stateEntries = entries;
+    guiCtx->stateEntriesCapacity = capacity;
+
+    return true;
+}
+
+// Get rectangle part inside current clip area, empty (zero size) if fully outside
+static Rectangle GuiClipRec(Rectangle rec)
+{
+    if (guiCtx->clipStackCount <= 0) return rec;
+
+    int scope = (guiCtx->clipStackCount < CLIPSTACK_MAX_SIZE)? guiCtx->clipStackCount : CLIPSTACK_MAX_SIZE;
+    Rectangle clip = guiCtx->clipStack[scope - 1];
+
+    float x0 = (rec.x > clip.x)? rec.x : clip.x;
+    float y0 = (rec.y > clip.y)? rec.y : clip.y;
+    float x1 = ((rec.x + rec.width) < (clip.x + clip.width))? (rec.x + rec.width) : (clip.x + clip.width);
+    float y1 = ((rec.y + rec.height) < (clip.y + clip.height))? (rec.y + rec.height) : (clip.y + clip.height);
+
+    Rectangle result = { x0, y0, (x1 > x0)? x1 - x0 : 0, (y1 > y0)? y1 - y0 : 0 };
+
+    return result;
+}
+
+// Check if bounds are fully outside current clip area (control can skip input and drawing)
+static bool GuiIsClipped(Rectangle bounds)
+{
+    if (guiCtx->clipStackCount <= 0) return false;
+
+    int scope = (guiCtx->clipStackCount < CLIPSTACK_MAX_SIZE)? guiCtx->clipStackCount : CLIPSTACK_MAX_SIZE;
+    Rectangle clip = guiCtx->clipStack[scope - 1];
+
+    return ((bounds.x >= (clip.x + clip.width)) || (bounds.y >= (clip.y + clip.height)) ||
+            ((bounds.x + bounds.width) <= clip.x) || ((bounds.y + bounds.height) <= clip.y));
+}
+
+// Check if bounds and side texts (drawn outside bounds) are fully outside current clip area
+// NOTE: Texts are only measured if bounds are clipped
+static bool GuiIsClippedText(Rectangle bounds, const char *textLeft, const char *textRight, int padding)
+{
+    if (!GuiIsClipped(bounds)) return false;
+
+    if (textLeft != NULL)
+    {
+        int width = GetTextWidth(textLeft) + padding;
+        bounds.x -= width;
+        bounds.width += width;
+    }
+
+    if (textRight != NULL) bounds.width += (GetTextWidth(textRight) + padding);
+
+    return GuiIsClipped(bounds);
+}
+
+// Begin scissor mode (limited to rectangle) or end it, directly or recorded
+// NOTE: Ended area is recorded with end command, so dirty rectangles cover it when clipping changes
+static void GuiDrawScissor(Rectangle rec, bool end)
+{
+    if (guiDrawListActive) GuiPushDrawCommand(end? GUI_DRAWCMD_SCISSOR_END : GUI_DRAWCMD_SCISSOR, rec, RAYGUI_CLITERAL(Color){ 0, 0, 0, 0 });
+    else if (end) EndScissorMode();
+    else BeginScissorMode(rec.x, rec.y, rec.width, rec.height);
+}
+
+// Draw rectangle, directly or recorded
+static void GuiDrawRectangle(int posX, int posY, int width, int height, Color color)
+{
+    if (guiDrawListActive) GuiPushDrawCommand(GUI_DRAWCMD_RECTANGLE, RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color);
+    else DrawRectangle(posX, posY, width, height, color);
+}
+
+// Draw rectangle, directly or recorded
+static void GuiDrawRectangleRec(Rectangle rec, Color color)
+{
+    if (guiDrawListActive) GuiPushDrawCommand(GUI_DRAWCMD_RECTANGLE, rec, color);
+    else DrawRectangleRec(rec, color);
+}
+
+// Draw rectangle border lines, directly or recorded
+// NOTE: Recorded as 4 rectangles
+static void GuiDrawRectangleLinesEx(Rectangle rec, int lineThick, Color color)
+{
+    if (guiDrawListActive)
+    {
+        GuiDrawRectangle(rec.x, rec.y, rec.width, lineThick, color);
+        GuiDrawRectangle(rec.x, rec.y + lineThick, lineThick, rec.height - 2*lineThick, color);
+        GuiDrawRectangle(rec.x + rec.width - lineThick, rec.y + lineThick, lineThick, rec.height - 2*lineThick, color);
+        GuiDrawRectangle(rec.x, rec.y + rec.height - lineThick, rec.width, lineThick, color);
+    }
+    else DrawRectangleLinesEx(rec, lineThick, color);
+}
+
+// Draw rectangle with vertex colors gradient, directly or recorded
+static void GuiDrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
+{
+    if (guiDrawListActive)
+    {
+        GuiDrawCommand *cmd = GuiPushDrawCommand(GUI_DRAWCMD_GRADIENT, rec, col1);
+        cmd->color[1] = col2;
+        cmd->color[2] = col3;
+        cmd->color[3] = col4;
+    }
+    else DrawRectangleGradientEx(rec, col1, col2, col3, col4);
+}
+
+// Draw rectangle with vertical gradient, directly or recorded
+static void GuiDrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2)
+{
+    if (guiDrawListActive) GuiDrawRectangleGradientEx(RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)width, (float)height }, color1, color2, color2, color1);
+    else DrawRectangleGradientV(posX, posY, width, height, color1, color2);
+}
+
+// Draw triangle, directly or recorded
+static void GuiDrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    if (guiDrawListActive)
+    {
+        // Triangle bounding rectangle
+        float minX = (v1.x < v2.x)? ((v1.x < v3.x)? v1.x : v3.x) : ((v2.x < v3.x)? v2.x : v3.x);
+        float minY = (v1.y < v2.y)? ((v1.y < v3.y)? v1.y : v3.y) : ((v2.y < v3.y)? v2.y : v3.y);
+        float maxX = (v1.x > v2.x)? ((v1.x > v3.x)? v1.x : v3.x) : ((v2.x > v3.x)? v2.x : v3.x);
+        float maxY = (v1.y > v2.y)? ((v1.y > v3.y)? v1.y : v3.y) : ((v2.y > v3.y)? v2.y : v3.y);
+        Rectangle rec = { minX, minY, maxX - minX, maxY - minY };
+
+        GuiDrawCommand *cmd = GuiPushDrawCommand(GUI_DRAWCMD_TRIANGLE, rec, color);
+        cmd->data.vertex[0] = v1;
+        cmd->data.vertex[1] = v2;
+        cmd->data.vertex[2] = v3;
+    }
+    else DrawTriangle(v1, v2, v3, color);
+}
+
+// Draw texture piece, directly or recorded
+static void GuiDrawTextureRec(Texture2D texture, Rectangle sourceRec, Vector2 position, Color tint)
+{
+    if (guiDrawListActive)
+    {
+        GuiDrawCommand *cmd = GuiPushDrawCommand(GUI_DRAWCMD_TEXTURE, RAYGUI_CLITERAL(Rectangle){ position.x, position.y, (sourceRec.width < 0)? -sourceRec.width : sourceRec.width, (sourceRec.height < 0)? -sourceRec.height : sourceRec.height }, tint);
+        cmd->data.texture.texture = texture;
+        cmd->data.texture.source = sourceRec;
+    }
+    else DrawTextureRec(texture, sourceRec, position, tint);
+}
+
+// Draw text line with gui font, directly or recorded
+static void GuiDrawTextEx(const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    if (guiDrawListActive)
+    {
+        Vector2 size = GuiMeasureText(text, fontSize, spacing);
+
+        GuiDrawCommand *cmd = GuiPushDrawCommand(GUI_DRAWCMD_TEXT, RAYGUI_CLITERAL(Rectangle){ position.x, position.y, size.x, size.y }, tint);
+        cmd->data.text.text = GuiPushDrawText(text);
+        cmd->data.text.fontSize = fontSize;
+        cmd->data.text.spacing = spacing;
+    }
+    else DrawTextEx(guiFont, text, position, fontSize, spacing, tint);
+}
+
+// Draw text inside rectangle with gui font, directly or recorded
+// NOTE: Text selection not supported by standalone backend
+static void GuiDrawTextRec(const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint,
+                           int selectStart, int selectLength, Color selectTint, Color selectBackTint)
+{
+    if (guiDrawListActive)
+    {
+        GuiDrawCommand *cmd = GuiPushDrawCommand(GUI_DRAWCMD_TEXT_REC, rec, tint);
+        cmd->color[1] = selectTint;
+        cmd->color[2] = selectBackTint;
+        cmd->data.text.text = GuiPushDrawText(text);
+        cmd->data.text.fontSize = fontSize;
+        cmd->data.text.spacing = spacing;
+        cmd->data.text.wordWrap = wordWrap;
+        cmd->data.text.selectStart = selectStart;
+        cmd->data.text.selectLength = selectLength;
+    }
+    else
+    {
+    #if defined(RAYGUI_STANDALONE)
+        DrawTextRec(guiFont, text, rec, fontSize, spacing, wordWrap, tint);
+    #else
+        DrawTextRecEx(guiFont, text, rec, fontSize, spacing, wordWrap, tint, selectStart, selectLength, selectTint, selectBackTint);
+    #endif
+    }
+}
+
+#if defined(RAYGUI_SUPPORT_ICONS)
+// Draw icon pixel runs as rectangles
+// NOTE: Consecutive pixels on every icon line are drawn as a single rectangle
+static void GuiDrawIconPixels(int iconId, Vector2 position, int pixelSize, Color color)
+{
+    const unsigned int *iconData = &guiIcons[iconId*RICON_DATA_ELEMENTS];
+
+    for (int y = 0; y < RICON_SIZE; y++)
+    {
+        for (int x = 0; x < RICON_SIZE; x++)
+        {
+            int runStart = x;
+            while ((x < RICON_SIZE) && (iconData[(y*RICON_SIZE + x)/32] & (1u << ((y*RICON_SIZE + x)%32)))) x++;
+
+            if (x > runStart) DrawRectangle(position.x + runStart*pixelSize, position.y + y*pixelSize, (x - runStart)*pixelSize, pixelSize, color);
+        }
+    }
+}
+
+#if !defined(RAYGUI_STANDALONE)
+// Bake icon pixels into icons atlas data
+static void GuiBakeIcon(int iconId)
+{
+    const unsigned int *iconData = &guiIcons[iconId*RICON_DATA_ELEMENTS];
+    int atlasWidth = RICON_ATLAS_COLUMNS*RICON_SIZE;
+    int offsetX = (iconId%RICON_ATLAS_COLUMNS)*RICON_SIZE;
+    int offsetY = (iconId/RICON_ATLAS_COLUMNS)*RICON_SIZE;
+
+    for (int p = 0; p < RICON_SIZE*RICON_SIZE; p++)
+    {
+        unsigned char *pixel = &guiIconsAtlasData[((offsetY + p/RICON_SIZE)*atlasWidth + offsetX + p%RICON_SIZE)*4];
+
+        pixel[0] = 255;
+        pixel[1] = 255;
+        pixel[2] = 255;
+        pixel[3] = (iconData[p/32] & (1u << (p%32)))? 255 : 0;
+    }
+
+    guiIconsDirty[iconId] = false;
+}
+
+// Bake icons atlas, only modified icons are re-baked
+// NOTE: Atlas texture is created on first use (graphic device must be initialized)
+static bool GuiUpdateIconsAtlas(void)
+{
+    if (guiIconsAtlas.id == 0)
+    {
+        if (guiIconsAtlasData == NULL) guiIconsAtlasData = (unsigned char *)RAYGUI_MALLOC(RICON_ATLAS_COLUMNS*RICON_SIZE*RICON_ATLAS_ROWS*RICON_SIZE*4);
+        if (guiIconsAtlasData == NULL) return false;
+
+        for (int i = 0; i < RICON_MAX_ICONS; i++) GuiBakeIcon(i);
+
+        Image atlas = { 0 };
+        atlas.data = guiIconsAtlasData;
+        atlas.width = RICON_ATLAS_COLUMNS*RICON_SIZE;
+        atlas.height = RICON_ATLAS_ROWS*RICON_SIZE;
+        atlas.mipmaps = 1;
+        atlas.format = UNCOMPRESSED_R8G8B8A8;
+
+        guiIconsAtlas = LoadTextureFromImage(atlas);
+        guiIconsAtlasDirty = false;
+    }
+    else if (guiIconsAtlasDirty)
+    {
+        for (int i = 0; i < RICON_MAX_ICONS; i++) if (guiIconsDirty[i]) GuiBakeIcon(i);
+
+        UpdateTexture(guiIconsAtlas, guiIconsAtlasData);
+        guiIconsAtlasDirty = false;
+    }
+
+    return (guiIconsAtlas.id != 0);
+}
+#endif      // !RAYGUI_STANDALONE
+#endif      // RAYGUI_SUPPORT_ICONS
+
+#if defined(RAYGUI_STANDALONE)
+// Returns a Color struct from hexadecimal value
+static Color GetColor(int hexValue)
+{
+    Color color;
 
     color.r = (unsigned char)(hexValue >> 24) & 0xFF;
     color.g = (unsigned char)(hexValue >> 16) & 0xFF;
@@ -3638,7 +5661,7 @@ static Color GetColor(int hexValue)
 }
 
 // Returns hexadecimal value for a Color
-static int ColorToInt(Color color)
+static inline int ColorToInt(Color color)
 {
     return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
 }
@@ -3664,15 +5687,19 @@ static Color Fade(Color color, float alpha)
 }
 
 // Formatting of text with variables to 'embed'
+// NOTE: Result is allocated from scratch arena, valid until scratch arena reset
 static const char *TextFormat(const char *text, ...)
 {
-    #define MAX_FORMATTEXT_LENGTH   64
+    va_list args;
+    va_start(args, text);
+    int length = vsnprintf(NULL, 0, text, args);
+    va_end(args);
 
-    static char buffer[MAX_FORMATTEXT_LENGTH];
+    char *buffer = (length >= 0)? (char *)GuiScratchAlloc(length + 1) : NULL;
+    if (buffer == NULL) return "";
 
-    va_list args;
     va_start(args, text);
-    vsprintf(buffer, text, args);
+    vsnprintf(buffer, length + 1, text, args);
     va_end(args);
 
     return buffer;
@@ -3701,43 +5728,46 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
     DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
 }
 
-#define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH    1024        // Size of static buffer: TextSplit()
-#define TEXTSPLIT_MAX_SUBSTRINGS_COUNT       128        // Size of static pointers array: TextSplit()
-
-
 // Split string into multiple strings
 const char **TextSplit(const char *text, char delimiter, int *count)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
-    // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
-    //      1. Maximum number of possible split strings is set by TEXTSPLIT_MAX_SUBSTRINGS_COUNT
-    //      2. Maximum size of text to split is TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
-
-    static const char *result[TEXTSPLIT_MAX_SUBSTRINGS_COUNT] = { NULL };
-    static char buffer[TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH);
+    // inserted between strings defined by "delimiter" parameter. Strings pointers and text copy are
+    // allocated from the scratch arena, results are valid until scratch arena reset
+    static const char *emptyResult[1] = { "" };   // Returned on allocation failure
 
-    result[0] = buffer;
+    int length = 0;
     int counter = 0;
 
     if (text != NULL)
     {
         counter = 1;
+        for (; text[length] != '\0'; length++) if (text[length] == delimiter) counter++;
+    }
 
-        // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH; i++)
-        {
-            buffer[i] = text[i];
-            if (buffer[i] == '\0') break;
-            else if (buffer[i] == delimiter)
-            {
-                buffer[i] = '\0';   // Set an end of string at this point
-                result[counter] = buffer + i + 1;
-                counter++;
+    unsigned char *memory = (unsigned char *)GuiScratchAlloc(((counter > 0)? counter : 1)*(int)sizeof(const char *) + length + 1);
 
-                if (counter == TEXTSPLIT_MAX_SUBSTRINGS_COUNT) break;
-            }
+    if (memory == NULL)
+    {
+        *count = 0;
+        return emptyResult;
+    }
+
+    const char **result = (const char **)memory;
+    char *buffer = (char *)(memory + ((counter > 0)? counter : 1)*sizeof(const char *));
+
+    if (text != NULL) memcpy(buffer, text, length + 1);
+    else buffer[0] = '\0';
+
+    result[0] = buffer;
+
+    // Point to every substring
+    for (int i = 0, k = 1; i < length; i++)
+    {
+        if (buffer[i] == delimiter)
+        {
+            buffer[i] = '\0';   // Set an end of string at this point
+            result[k++] = buffer + i + 1;
         }
     }
 